@@ -0,0 +1,292 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Data/UINavInputRecording.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace UINavInputRecording
+{
+	constexpr uint32 FileMagic = 0x524E4955; // "UINR"
+	constexpr uint32 FileVersion = 1;
+
+	// The smallest amount of bytes each serialized record can take, used to reject counts the rest of the file can't hold
+	constexpr int64 MinKeyNameSize = sizeof(int32); // Empty FString
+	constexpr int64 MinEventSize = sizeof(uint8) + sizeof(double) + sizeof(uint32) + sizeof(int32) + sizeof(uint32) + sizeof(uint16) + sizeof(uint32) + sizeof(int32); // Bools are serialized as uint32
+	constexpr int64 PressedButtonIndexSize = sizeof(int32);
+
+	bool IsCountValid(const FArchive& Ar, const int32 Count, const int64 MinRecordSize)
+	{
+		return Count >= 0 && Count <= (Ar.TotalSize() - Ar.Tell()) / MinRecordSize;
+	}
+
+	enum EModifierFlag : uint16
+	{
+		LeftShift = 1 << 0,
+		RightShift = 1 << 1,
+		LeftControl = 1 << 2,
+		RightControl = 1 << 3,
+		LeftAlt = 1 << 4,
+		RightAlt = 1 << 5,
+		LeftCommand = 1 << 6,
+		RightCommand = 1 << 7,
+		CapsLocked = 1 << 8
+	};
+
+	uint16 GetModifierFlags(const FModifierKeysState& ModifierKeys)
+	{
+		return (ModifierKeys.IsLeftShiftDown() ? LeftShift : 0) |
+			(ModifierKeys.IsRightShiftDown() ? RightShift : 0) |
+			(ModifierKeys.IsLeftControlDown() ? LeftControl : 0) |
+			(ModifierKeys.IsRightControlDown() ? RightControl : 0) |
+			(ModifierKeys.IsLeftAltDown() ? LeftAlt : 0) |
+			(ModifierKeys.IsRightAltDown() ? RightAlt : 0) |
+			(ModifierKeys.IsLeftCommandDown() ? LeftCommand : 0) |
+			(ModifierKeys.IsRightCommandDown() ? RightCommand : 0) |
+			(ModifierKeys.AreCapsLocked() ? CapsLocked : 0);
+	}
+
+	FModifierKeysState MakeModifierKeys(const uint16 Flags)
+	{
+		return FModifierKeysState(
+			(Flags & LeftShift) != 0,
+			(Flags & RightShift) != 0,
+			(Flags & LeftControl) != 0,
+			(Flags & RightControl) != 0,
+			(Flags & LeftAlt) != 0,
+			(Flags & RightAlt) != 0,
+			(Flags & LeftCommand) != 0,
+			(Flags & RightCommand) != 0,
+			(Flags & CapsLocked) != 0);
+	}
+}
+
+void FUINavInputRecording::Reset()
+{
+	Events.Reset();
+	KeyNames.Reset();
+	KeyNameIndices.Reset();
+}
+
+void FUINavInputRecording::AddKeyEvent(const EUINavRecordedInputType Type, const double Time, const uint32 Frame, const FKeyEvent& KeyEvent)
+{
+	FUINavRecordedInputEvent& Event = Events.AddDefaulted_GetRef();
+	Event.Type = Type;
+	Event.Time = Time;
+	Event.Frame = Frame;
+	Event.DeviceId = KeyEvent.GetInputDeviceId().GetId();
+	Event.UserIndex = KeyEvent.GetUserIndex();
+	Event.ModifierFlags = UINavInputRecording::GetModifierFlags(KeyEvent.GetModifierKeys());
+	Event.bIsRepeat = KeyEvent.IsRepeat();
+	Event.KeyIndex = GetKeyIndex(KeyEvent.GetKey());
+}
+
+void FUINavInputRecording::AddAnalogEvent(const double Time, const uint32 Frame, const FAnalogInputEvent& AnalogEvent)
+{
+	AddKeyEvent(EUINavRecordedInputType::Analog, Time, Frame, AnalogEvent);
+	Events.Last().Value = AnalogEvent.GetAnalogValue();
+}
+
+void FUINavInputRecording::AddPointerEvent(const EUINavRecordedInputType Type, const double Time, const uint32 Frame, const FPointerEvent& PointerEvent)
+{
+	FUINavRecordedInputEvent& Event = Events.AddDefaulted_GetRef();
+	Event.Type = Type;
+	Event.Time = Time;
+	Event.Frame = Frame;
+	Event.DeviceId = PointerEvent.GetInputDeviceId().GetId();
+	Event.UserIndex = PointerEvent.GetUserIndex();
+	Event.ModifierFlags = UINavInputRecording::GetModifierFlags(PointerEvent.GetModifierKeys());
+	Event.bIsRepeat = PointerEvent.IsRepeat();
+	Event.KeyIndex = GetKeyIndex(PointerEvent.GetEffectingButton());
+	Event.Value = PointerEvent.GetWheelDelta();
+	Event.ScreenPosition = FVector2f(PointerEvent.GetScreenSpacePosition());
+	Event.LastScreenPosition = FVector2f(PointerEvent.GetLastScreenSpacePosition());
+
+	const TSet<FKey>& PressedButtons = PointerEvent.GetPressedButtons();
+	Event.PressedButtonIndices.Reserve(PressedButtons.Num());
+	for (const FKey& PressedButton : PressedButtons)
+	{
+		Event.PressedButtonIndices.Add(GetKeyIndex(PressedButton));
+	}
+}
+
+FKeyEvent FUINavInputRecording::MakeKeyEvent(const FUINavRecordedInputEvent& Event) const
+{
+	return FKeyEvent(GetKey(Event.KeyIndex),
+		UINavInputRecording::MakeModifierKeys(Event.ModifierFlags),
+		FInputDeviceId::CreateFromInternalId(Event.DeviceId),
+		Event.bIsRepeat,
+		0,
+		0,
+		static_cast<int32>(Event.UserIndex));
+}
+
+FAnalogInputEvent FUINavInputRecording::MakeAnalogEvent(const FUINavRecordedInputEvent& Event) const
+{
+	return FAnalogInputEvent(GetKey(Event.KeyIndex),
+		UINavInputRecording::MakeModifierKeys(Event.ModifierFlags),
+		FInputDeviceId::CreateFromInternalId(Event.DeviceId),
+		Event.bIsRepeat,
+		0,
+		0,
+		Event.Value,
+		static_cast<int32>(Event.UserIndex));
+}
+
+FPointerEvent FUINavInputRecording::MakePointerEvent(const FUINavRecordedInputEvent& Event) const
+{
+	TSet<FKey> PressedButtons;
+	PressedButtons.Reserve(Event.PressedButtonIndices.Num());
+	for (const int32 PressedButtonIndex : Event.PressedButtonIndices)
+	{
+		PressedButtons.Add(GetKey(PressedButtonIndex));
+	}
+
+	return FPointerEvent(FInputDeviceId::CreateFromInternalId(Event.DeviceId),
+		FSlateApplicationBase::CursorPointerIndex,
+		Event.ScreenPosition,
+		Event.LastScreenPosition,
+		PressedButtons,
+		GetKey(Event.KeyIndex),
+		Event.Value,
+		UINavInputRecording::MakeModifierKeys(Event.ModifierFlags),
+		static_cast<int32>(Event.UserIndex));
+}
+
+bool FUINavInputRecording::SaveToFile(const FString& FilePath) const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	const_cast<FUINavInputRecording*>(this)->Serialize(Writer);
+	return FFileHelper::SaveArrayToFile(Bytes, *FilePath);
+}
+
+bool FUINavInputRecording::LoadFromFile(const FString& FilePath)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	Serialize(Reader);
+	if (Reader.IsError())
+	{
+		Reset();
+		return false;
+	}
+
+	KeyNameIndices.Reset();
+	for (int32 i = 0; i < KeyNames.Num(); ++i)
+	{
+		KeyNameIndices.Add(KeyNames[i], i);
+	}
+	return true;
+}
+
+int32 FUINavInputRecording::GetKeyIndex(const FKey& Key)
+{
+	const FName KeyName = Key.GetFName();
+	if (const int32* KeyIndex = KeyNameIndices.Find(KeyName))
+	{
+		return *KeyIndex;
+	}
+
+	const int32 NewKeyIndex = KeyNames.Add(KeyName);
+	KeyNameIndices.Add(KeyName, NewKeyIndex);
+	return NewKeyIndex;
+}
+
+FKey FUINavInputRecording::GetKey(const int32 KeyIndex) const
+{
+	return KeyNames.IsValidIndex(KeyIndex) ? FKey(KeyNames[KeyIndex]) : FKey();
+}
+
+void FUINavInputRecording::Serialize(FArchive& Ar)
+{
+	uint32 Magic = UINavInputRecording::FileMagic;
+	uint32 Version = UINavInputRecording::FileVersion;
+	Ar << Magic << Version;
+	if (Magic != UINavInputRecording::FileMagic || Version != UINavInputRecording::FileVersion)
+	{
+		Ar.SetError();
+		return;
+	}
+
+	int32 NumKeys = KeyNames.Num();
+	Ar << NumKeys;
+	if (Ar.IsLoading())
+	{
+		if (!UINavInputRecording::IsCountValid(Ar, NumKeys, UINavInputRecording::MinKeyNameSize))
+		{
+			Ar.SetError();
+			return;
+		}
+		KeyNames.SetNum(NumKeys);
+	}
+	for (FName& KeyName : KeyNames)
+	{
+		FString KeyString = KeyName.ToString();
+		Ar << KeyString;
+		if (Ar.IsLoading())
+		{
+			KeyName = FName(*KeyString);
+		}
+	}
+
+	int32 NumEvents = Events.Num();
+	Ar << NumEvents;
+	if (Ar.IsLoading())
+	{
+		if (!UINavInputRecording::IsCountValid(Ar, NumEvents, UINavInputRecording::MinEventSize))
+		{
+			Ar.SetError();
+			return;
+		}
+		Events.SetNum(NumEvents);
+	}
+	for (FUINavRecordedInputEvent& Event : Events)
+	{
+		uint8 Type = static_cast<uint8>(Event.Type);
+		Ar << Type;
+		Event.Type = static_cast<EUINavRecordedInputType>(Type);
+		Ar << Event.Time << Event.Frame << Event.DeviceId << Event.UserIndex << Event.ModifierFlags << Event.bIsRepeat << Event.KeyIndex;
+
+		switch (Event.Type)
+		{
+			case EUINavRecordedInputType::KeyDown:
+			case EUINavRecordedInputType::KeyUp:
+				break;
+			case EUINavRecordedInputType::Analog:
+				Ar << Event.Value;
+				break;
+			default:
+			{
+				Ar << Event.Value << Event.ScreenPosition << Event.LastScreenPosition;
+				uint8 NumPressedButtons = static_cast<uint8>(Event.PressedButtonIndices.Num());
+				Ar << NumPressedButtons;
+				if (Ar.IsLoading())
+				{
+					if (!UINavInputRecording::IsCountValid(Ar, NumPressedButtons, UINavInputRecording::PressedButtonIndexSize))
+					{
+						Ar.SetError();
+						return;
+					}
+					Event.PressedButtonIndices.SetNum(NumPressedButtons);
+				}
+				for (int32& PressedButtonIndex : Event.PressedButtonIndices)
+				{
+					Ar << PressedButtonIndex;
+				}
+				break;
+			}
+		}
+
+		if (Ar.IsError())
+		{
+			return;
+		}
+	}
+}
@@ -0,0 +1,155 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Data/UINavKeyClassification.h"
+#include "Data/InputRestriction.h"
+#include "UINavMacros.h"
+#include "IXRTrackingSystem.h"
+
+namespace UINavKeyClassification
+{
+	struct FCategory
+	{
+		const TCHAR* Name;
+		uint16 Flag;
+	};
+
+	const FCategory Categories[] =
+	{
+		{ TEXT("Oculus"), FUINavKeyClassification::Oculus },
+		{ TEXT("Vive"), FUINavKeyClassification::Vive },
+		{ TEXT("MixedReality"), FUINavKeyClassification::MixedReality },
+		{ TEXT("Valve"), FUINavKeyClassification::Valve },
+		{ TEXT("PSMove"), FUINavKeyClassification::PSMove }
+	};
+
+	TMap<FName, uint16> KeyFlags;
+
+	const IXRTrackingSystem* XRSystem = nullptr;
+	uint16 XRSystemFlags = 0;
+
+	uint16 ClassifyKey(const FKey& Key)
+	{
+		uint16 Flags = 0;
+		if (Key.IsMouseButton())
+		{
+			Flags |= FUINavKeyClassification::Mouse;
+		}
+		if (Key.IsGamepadKey())
+		{
+			Flags |= FUINavKeyClassification::Gamepad;
+		}
+
+		const FString KeyName = Key.ToString();
+		for (const FCategory& Category : Categories)
+		{
+			if (KeyName.Contains(Category.Name))
+			{
+				Flags |= Category.Flag;
+			}
+		}
+		return Flags;
+	}
+}
+
+void FUINavKeyClassification::Build()
+{
+	TArray<FKey> AllKeys;
+	EKeys::GetAllKeys(AllKeys);
+
+	UINavKeyClassification::KeyFlags.Reset();
+	UINavKeyClassification::KeyFlags.Reserve(AllKeys.Num());
+	for (const FKey& Key : AllKeys)
+	{
+		UINavKeyClassification::KeyFlags.Add(Key.GetFName(), UINavKeyClassification::ClassifyKey(Key));
+	}
+}
+
+void FUINavKeyClassification::Reset()
+{
+	UINavKeyClassification::KeyFlags.Empty();
+	UINavKeyClassification::XRSystem = nullptr;
+	UINavKeyClassification::XRSystemFlags = 0;
+}
+
+uint16 FUINavKeyClassification::GetKeyFlags(const FKey& Key)
+{
+	if (const uint16* Flags = UINavKeyClassification::KeyFlags.Find(Key.GetFName()))
+	{
+		return *Flags;
+	}
+
+	const uint16 Flags = UINavKeyClassification::ClassifyKey(Key);
+
+	// Keys without details might still be registered later, so only keys that are already registered are kept
+	if (Key.IsValid())
+	{
+		UINavKeyClassification::KeyFlags.Add(Key.GetFName(), Flags);
+	}
+	return Flags;
+}
+
+uint16 FUINavKeyClassification::GetCategoryFlag(const FString& Category)
+{
+	for (const UINavKeyClassification::FCategory& KnownCategory : UINavKeyClassification::Categories)
+	{
+		if (Category.Equals(KnownCategory.Name, ESearchCase::IgnoreCase))
+		{
+			return KnownCategory.Flag;
+		}
+	}
+	return 0;
+}
+
+uint16 FUINavKeyClassification::GetXRSystemFlags()
+{
+#if IS_VR_PLATFORM
+	const IXRTrackingSystem* const XRSystem = GEngine->XRSystem.Get();
+#else
+	const IXRTrackingSystem* const XRSystem = nullptr;
+#endif
+
+	if (XRSystem != UINavKeyClassification::XRSystem)
+	{
+		UINavKeyClassification::XRSystem = XRSystem;
+		UINavKeyClassification::XRSystemFlags = 0;
+		if (XRSystem != nullptr)
+		{
+			const FName SystemName = XRSystem->GetSystemName();
+			if (SystemName == FName(TEXT("OculusHMD")))
+			{
+				UINavKeyClassification::XRSystemFlags = Oculus;
+			}
+			else if (SystemName == FName(TEXT("Morpheus")))
+			{
+				UINavKeyClassification::XRSystemFlags = PSMove;
+			}
+		}
+	}
+
+	return UINavKeyClassification::XRSystemFlags;
+}
+
+bool FUINavKeyClassification::RespectsRestriction(const FKey& Key, const EInputRestriction Restriction)
+{
+	if (Restriction == EInputRestriction::None)
+	{
+		return true;
+	}
+
+	const uint16 Flags = GetKeyFlags(Key);
+	switch (Restriction)
+	{
+	case EInputRestriction::Keyboard:
+		return (Flags & (Mouse | Gamepad)) == 0;
+	case EInputRestriction::Mouse:
+		return (Flags & Mouse) != 0;
+	case EInputRestriction::Keyboard_Mouse:
+		return (Flags & Gamepad) == 0;
+	case EInputRestriction::VR:
+		return (Flags & GetXRSystemFlags()) != 0;
+	case EInputRestriction::Gamepad:
+		return (Flags & Gamepad) != 0 && (Flags & VR) == 0;
+	}
+
+	return false;
+}
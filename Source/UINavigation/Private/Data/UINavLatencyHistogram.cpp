@@ -0,0 +1,68 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Data/UINavLatencyHistogram.h"
+
+namespace UINavLatencyHistogram
+{
+	template<typename T>
+	T GetPercentile(const TArray<T>& SortedSamples, const float Percentile)
+	{
+		const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * SortedSamples.Num()) - 1, 0, SortedSamples.Num() - 1);
+		return SortedSamples[Index];
+	}
+}
+
+void FUINavLatencyHistogram::CloseSpan(FUINavLatencySpan& Span)
+{
+	if (!Span.IsOpen())
+	{
+		return;
+	}
+
+	AddSample(static_cast<float>((FPlatformTime::Seconds() - Span.StartTime) * 1000.0), static_cast<int32>(GFrameCounter - Span.StartFrame));
+	Span.Close();
+}
+
+void FUINavLatencyHistogram::AddSample(const float SampleMilliseconds, const int32 SampleFrames)
+{
+	if (Milliseconds.Num() < MaxSamples)
+	{
+		Milliseconds.Add(SampleMilliseconds);
+		Frames.Add(SampleFrames);
+		return;
+	}
+
+	Milliseconds[NextSampleIndex] = SampleMilliseconds;
+	Frames[NextSampleIndex] = SampleFrames;
+	NextSampleIndex = (NextSampleIndex + 1) % MaxSamples;
+}
+
+FInputLatencyStats FUINavLatencyHistogram::GetStats() const
+{
+	FInputLatencyStats Stats;
+	Stats.SampleCount = Milliseconds.Num();
+	if (Stats.SampleCount == 0)
+	{
+		return Stats;
+	}
+
+	TArray<float> SortedMilliseconds = Milliseconds;
+	SortedMilliseconds.Sort();
+	Stats.P50Milliseconds = UINavLatencyHistogram::GetPercentile(SortedMilliseconds, 0.5f);
+	Stats.P95Milliseconds = UINavLatencyHistogram::GetPercentile(SortedMilliseconds, 0.95f);
+	Stats.P99Milliseconds = UINavLatencyHistogram::GetPercentile(SortedMilliseconds, 0.99f);
+
+	TArray<int32> SortedFrames = Frames;
+	SortedFrames.Sort();
+	Stats.P50Frames = UINavLatencyHistogram::GetPercentile(SortedFrames, 0.5f);
+	Stats.P95Frames = UINavLatencyHistogram::GetPercentile(SortedFrames, 0.95f);
+	Stats.P99Frames = UINavLatencyHistogram::GetPercentile(SortedFrames, 0.99f);
+	return Stats;
+}
+
+void FUINavLatencyHistogram::Reset()
+{
+	Milliseconds.Reset();
+	Frames.Reset();
+	NextSampleIndex = 0;
+}
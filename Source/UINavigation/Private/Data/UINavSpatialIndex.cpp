@@ -0,0 +1,263 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Data/UINavSpatialIndex.h"
+#include "UINavComponent.h"
+
+namespace UINavSpatialIndex
+{
+	// Components covering more cells than this are kept out of the grid
+	constexpr int32 MaxCellsPerComponent = 64;
+
+	// How much a candidate may overlap the source's leading edge and still be considered to be in front of it
+	constexpr float EdgeTolerance = 0.5f;
+
+	bool GetAxisAndSign(const EUINavigation Direction, int32& OutAxis, int32& OutSign)
+	{
+		switch (Direction)
+		{
+			case EUINavigation::Left: OutAxis = 0; OutSign = -1; return true;
+			case EUINavigation::Right: OutAxis = 0; OutSign = 1; return true;
+			case EUINavigation::Up: OutAxis = 1; OutSign = -1; return true;
+			case EUINavigation::Down: OutAxis = 1; OutSign = 1; return true;
+			default: return false;
+		}
+	}
+}
+
+void FUINavSpatialIndex::Reset(const float InCellSize)
+{
+	CellSize = FMath::Max(InCellSize, 1.0f);
+	Rects.Reset();
+	Cells.Reset();
+	OversizedComponents.Reset();
+	MinCell = FIntPoint(MAX_int32, MAX_int32);
+	MaxCell = FIntPoint(MIN_int32, MIN_int32);
+}
+
+void FUINavSpatialIndex::Update(UUINavComponent* Component, const FBox2D& Rect)
+{
+	if (!IsValid(Component))
+	{
+		return;
+	}
+
+	if (const FBox2D* OldRect = Rects.Find(Component))
+	{
+		if (OldRect->Min.Equals(Rect.Min) && OldRect->Max.Equals(Rect.Max))
+		{
+			return;
+		}
+
+		RemoveFromCells(Component, *OldRect);
+	}
+
+	Rects.Add(Component, Rect);
+	AddToCells(Component, Rect);
+}
+
+void FUINavSpatialIndex::Remove(UUINavComponent* Component)
+{
+	FBox2D OldRect;
+	if (Rects.RemoveAndCopyValue(Component, OldRect))
+	{
+		RemoveFromCells(Component, OldRect);
+	}
+}
+
+UUINavComponent* FUINavSpatialIndex::FindNext(const UUINavComponent* FromComponent, const FBox2D& FromRect, const EUINavigation Direction, TFunctionRef<bool(UUINavComponent*)> Filter) const
+{
+	if (Rects.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	int32 Axis;
+	int32 Sign;
+	if (!UINavSpatialIndex::GetAxisAndSign(Direction, Axis, Sign))
+	{
+		return nullptr;
+	}
+	const int32 OtherAxis = 1 - Axis;
+
+	const double Edge = Sign > 0 ? FromRect.Max[Axis] : FromRect.Min[Axis];
+	const double BandMin = FromRect.Min[OtherAxis];
+	const double BandMax = FromRect.Max[OtherAxis];
+
+	UUINavComponent* BestComponent = nullptr;
+	double BestDistance = MAX_dbl;
+	double BestOffset = MAX_dbl;
+
+	auto ConsiderCandidate = [&](const TWeakObjectPtr<UUINavComponent>& WeakCandidate)
+	{
+		UUINavComponent* Candidate = WeakCandidate.Get();
+		if (Candidate == nullptr || Candidate == FromComponent)
+		{
+			return;
+		}
+
+		const FBox2D* CandidateRect = Rects.Find(WeakCandidate);
+		double Distance;
+		double Offset;
+		if (CandidateRect == nullptr || !GetNavigationScore(FromRect, *CandidateRect, Direction, Distance, Offset))
+		{
+			return;
+		}
+
+		if (Distance > BestDistance || (Distance == BestDistance && Offset >= BestOffset))
+		{
+			return;
+		}
+
+		if (!Filter(Candidate))
+		{
+			return;
+		}
+
+		BestComponent = Candidate;
+		BestDistance = Distance;
+		BestOffset = Offset;
+	};
+
+	for (const TWeakObjectPtr<UUINavComponent>& OversizedComponent : OversizedComponents)
+	{
+		ConsiderCandidate(OversizedComponent);
+	}
+
+	if (MinCell.X > MaxCell.X)
+	{
+		return BestComponent;
+	}
+
+	const FIntPoint EdgeCell = GetCell(FVector2D(Edge, Edge));
+	const FIntPoint BandMinCell = GetCell(FVector2D(BandMin, BandMin));
+	const FIntPoint BandMaxCell = GetCell(FVector2D(BandMax, BandMax));
+
+	const int32 FirstRow = FMath::Max(BandMinCell[OtherAxis], MinCell[OtherAxis]);
+	const int32 LastRow = FMath::Min(BandMaxCell[OtherAxis], MaxCell[OtherAxis]);
+	if (FirstRow > LastRow)
+	{
+		return BestComponent;
+	}
+
+	const int32 LastColumn = Sign > 0 ? MaxCell[Axis] : MinCell[Axis];
+	for (int32 Column = EdgeCell[Axis]; Sign > 0 ? Column <= LastColumn : Column >= LastColumn; Column += Sign)
+	{
+		// Nothing in this column or past it can be closer than what was already found
+		const double ColumnDistance = Sign > 0 ? Column * CellSize - Edge : Edge - (Column + 1) * CellSize;
+		if (BestComponent != nullptr && ColumnDistance > BestDistance)
+		{
+			break;
+		}
+
+		for (int32 Row = FirstRow; Row <= LastRow; ++Row)
+		{
+			const FIntPoint Cell = Axis == 0 ? FIntPoint(Column, Row) : FIntPoint(Row, Column);
+			if (const TArray<TWeakObjectPtr<UUINavComponent>>* CellComponents = Cells.Find(Cell))
+			{
+				for (const TWeakObjectPtr<UUINavComponent>& CellComponent : *CellComponents)
+				{
+					ConsiderCandidate(CellComponent);
+				}
+			}
+		}
+	}
+
+	return BestComponent;
+}
+
+bool FUINavSpatialIndex::GetNavigationScore(const FBox2D& FromRect, const FBox2D& CandidateRect, const EUINavigation Direction, double& OutDistance, double& OutOffset)
+{
+	int32 Axis;
+	int32 Sign;
+	if (!UINavSpatialIndex::GetAxisAndSign(Direction, Axis, Sign))
+	{
+		return false;
+	}
+	const int32 OtherAxis = 1 - Axis;
+
+	const double BandMin = FromRect.Min[OtherAxis];
+	const double BandMax = FromRect.Max[OtherAxis];
+	if (CandidateRect.Min[OtherAxis] >= BandMax || CandidateRect.Max[OtherAxis] <= BandMin)
+	{
+		return false;
+	}
+
+	OutDistance = Sign > 0 ? CandidateRect.Min[Axis] - FromRect.Max[Axis] : FromRect.Min[Axis] - CandidateRect.Max[Axis];
+	if (OutDistance < -UINavSpatialIndex::EdgeTolerance)
+	{
+		return false;
+	}
+
+	OutOffset = FMath::Abs((CandidateRect.Min[OtherAxis] + CandidateRect.Max[OtherAxis]) * 0.5f - (BandMin + BandMax) * 0.5f);
+	return true;
+}
+
+const FBox2D* FUINavSpatialIndex::GetRect(const UUINavComponent* Component) const
+{
+	return Rects.Find(const_cast<UUINavComponent*>(Component));
+}
+
+void FUINavSpatialIndex::GetComponents(TArray<UUINavComponent*>& OutComponents) const
+{
+	OutComponents.Reserve(OutComponents.Num() + Rects.Num());
+	for (const TPair<TWeakObjectPtr<UUINavComponent>, FBox2D>& Entry : Rects)
+	{
+		if (UUINavComponent* Component = Entry.Key.Get())
+		{
+			OutComponents.Add(Component);
+		}
+	}
+}
+
+FIntPoint FUINavSpatialIndex::GetCell(const FVector2D& Position) const
+{
+	return FIntPoint(FMath::FloorToInt(Position.X / CellSize), FMath::FloorToInt(Position.Y / CellSize));
+}
+
+void FUINavSpatialIndex::AddToCells(UUINavComponent* Component, const FBox2D& Rect)
+{
+	const FIntPoint FirstCell = GetCell(Rect.Min);
+	const FIntPoint LastCell = GetCell(Rect.Max);
+	if ((LastCell.X - FirstCell.X + 1) * (LastCell.Y - FirstCell.Y + 1) > UINavSpatialIndex::MaxCellsPerComponent)
+	{
+		OversizedComponents.Add(Component);
+		return;
+	}
+
+	for (int32 X = FirstCell.X; X <= LastCell.X; ++X)
+	{
+		for (int32 Y = FirstCell.Y; Y <= LastCell.Y; ++Y)
+		{
+			Cells.FindOrAdd(FIntPoint(X, Y)).Add(Component);
+		}
+	}
+
+	MinCell = FIntPoint(FMath::Min(MinCell.X, FirstCell.X), FMath::Min(MinCell.Y, FirstCell.Y));
+	MaxCell = FIntPoint(FMath::Max(MaxCell.X, LastCell.X), FMath::Max(MaxCell.Y, LastCell.Y));
+}
+
+void FUINavSpatialIndex::RemoveFromCells(UUINavComponent* Component, const FBox2D& Rect)
+{
+	if (OversizedComponents.RemoveSingleSwap(Component, EAllowShrinking::No) > 0)
+	{
+		return;
+	}
+
+	const FIntPoint FirstCell = GetCell(Rect.Min);
+	const FIntPoint LastCell = GetCell(Rect.Max);
+	for (int32 X = FirstCell.X; X <= LastCell.X; ++X)
+	{
+		for (int32 Y = FirstCell.Y; Y <= LastCell.Y; ++Y)
+		{
+			const FIntPoint Cell(X, Y);
+			if (TArray<TWeakObjectPtr<UUINavComponent>>* CellComponents = Cells.Find(Cell))
+			{
+				CellComponents->RemoveSingleSwap(Component, EAllowShrinking::No);
+				if (CellComponents->Num() == 0)
+				{
+					Cells.Remove(Cell);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,330 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Tests/UINavTestEnvironment.h"
+#include "UINavComponent.h"
+#include "UINavPCComponent.h"
+#include "UINavSettings.h"
+#include "UINavWidget.h"
+#include "Data/UINavEnhancedInputActions.h"
+#include "EnhancedInputSubsystems.h"
+#include "InputMappingContext.h"
+#include "PlayerMappableKeySettings.h"
+#include "Engine/LocalPlayer.h"
+#include "Misc/AutomationTest.h"
+#include "UserSettings/EnhancedInputUserSettings.h"
+
+BEGIN_DEFINE_SPEC(FUINavNavigationSpec, "UINavigation.Navigation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+	TUniquePtr<FUINavTestEnvironment> Environment;
+	UUINavWidget* Menu = nullptr;
+
+	void CreateMenu(const bool bUseSpatialNavigationIndex = false);
+	UUINavComponent* GetComponent(const int32 Index) const;
+	UEnhancedInputUserSettings* GetUserSettings() const;
+	FName FindMenuDownMappingName() const;
+	FKey GetMappedKey(const FName MappingName) const;
+
+END_DEFINE_SPEC(FUINavNavigationSpec)
+
+void FUINavNavigationSpec::CreateMenu(const bool bUseSpatialNavigationIndex /*= false*/)
+{
+	Menu = Environment->CreateMenu(3, bUseSpatialNavigationIndex);
+	if (!TestTrue(TEXT("Setup completed"), Environment->WaitForSetup(Menu)))
+	{
+		Menu = nullptr;
+	}
+}
+
+UUINavComponent* FUINavNavigationSpec::GetComponent(const int32 Index) const
+{
+	const TArray<UUINavComponent*> Components = FUINavTestEnvironment::GetMenuComponents(Menu);
+	return Components.IsValidIndex(Index) ? Components[Index] : nullptr;
+}
+
+UEnhancedInputUserSettings* FUINavNavigationSpec::GetUserSettings() const
+{
+	const UEnhancedInputLocalPlayerSubsystem* const Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(Environment->GetLocalPlayer());
+	return Subsystem != nullptr ? Subsystem->GetUserSettings() : nullptr;
+}
+
+FName FUINavNavigationSpec::FindMenuDownMappingName() const
+{
+	const UUINavEnhancedInputActions* const InputActions = GetDefault<UUINavSettings>()->EnhancedInputActions.LoadSynchronous();
+	UEnhancedInputUserSettings* const UserSettings = GetUserSettings();
+	UInputMappingContext* const UINavContext = Environment->GetUINavPC()->GetUINavInputContext(Menu);
+	if (!IsValid(InputActions) || !IsValid(UserSettings) || !IsValid(UINavContext))
+	{
+		return NAME_None;
+	}
+
+	UserSettings->RegisterInputMappingContext(UINavContext);
+
+	for (const FEnhancedActionKeyMapping& Mapping : UINavContext->GetMappings())
+	{
+		const UPlayerMappableKeySettings* const KeySettings = Mapping.GetPlayerMappableKeySettings();
+		if (Mapping.Action == InputActions->IA_MenuDown && IsValid(KeySettings))
+		{
+			return KeySettings->Name;
+		}
+	}
+
+	return NAME_None;
+}
+
+FKey FUINavNavigationSpec::GetMappedKey(const FName MappingName) const
+{
+	const UEnhancedInputUserSettings* const UserSettings = GetUserSettings();
+	const FPlayerKeyMapping* const Mapping = IsValid(UserSettings) ? UserSettings->FindCurrentMappingForSlot(MappingName, EPlayerMappableKeySlot::First) : nullptr;
+	return Mapping != nullptr ? Mapping->GetCurrentKey() : FKey();
+}
+
+void FUINavNavigationSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Environment = MakeUnique<FUINavTestEnvironment>();
+		if (TestTrue(TEXT("Environment is valid"), Environment->IsValid()))
+		{
+			CreateMenu();
+		}
+	});
+
+	AfterEach([this]()
+	{
+		Menu = nullptr;
+		Environment.Reset();
+	});
+
+	Describe("Setup", [this]()
+	{
+		It("should focus the first component and become the active widget", [this]()
+		{
+			if (Menu == nullptr)
+			{
+				return;
+			}
+
+			TestTrue(TEXT("First component is current"), Menu->GetCurrentComponent() == GetComponent(0));
+			TestTrue(TEXT("Menu is the active widget"), Environment->GetUINavPC()->GetActiveWidget() == Menu);
+		});
+	});
+
+	Describe("Keyboard navigation", [this]()
+	{
+		It("should move focus down and up with the arrow keys", [this]()
+		{
+			if (Menu == nullptr)
+			{
+				return;
+			}
+
+			Environment->PressKey(EKeys::Down);
+			// Selector updates wait for the layout, which happens at the end of the tick after the one that navigated
+			Environment->Tick(2);
+
+			TestTrue(TEXT("Second component is current"), Menu->GetCurrentComponent() == GetComponent(1));
+			TestEqual(TEXT("Input type"), Environment->GetUINavPC()->GetCurrentInputType(), EInputType::Keyboard);
+			TestTrue(TEXT("Selector is visible"), Menu->IsSelectorVisible());
+
+			Environment->PressKey(EKeys::Up);
+			TestTrue(TEXT("First component is current"), Menu->GetCurrentComponent() == GetComponent(0));
+		});
+	});
+
+	Describe("Gamepad navigation", [this]()
+	{
+		It("should move focus with the left thumbstick", [this]()
+		{
+			if (Menu == nullptr)
+			{
+				return;
+			}
+
+			Environment->SendAnalog(EKeys::Gamepad_LeftY, -1.0f);
+			Environment->SendAnalog(EKeys::Gamepad_LeftY, 0.0f);
+			Environment->Tick();
+
+			TestTrue(TEXT("Second component is current"), Menu->GetCurrentComponent() == GetComponent(1));
+			TestEqual(TEXT("Input type"), Environment->GetUINavPC()->GetCurrentInputType(), EInputType::Gamepad);
+		});
+	});
+
+	Describe("Mouse input", [this]()
+	{
+		It("should switch the input type to mouse", [this]()
+		{
+			if (Menu == nullptr)
+			{
+				return;
+			}
+
+			Environment->PressKey(EKeys::Down);
+			Environment->MoveMouse(FVector2D(10.0, 10.0), FVector2D(50.0, 50.0));
+			Environment->Tick();
+
+			TestEqual(TEXT("Input type"), Environment->GetUINavPC()->GetCurrentInputType(), EInputType::Mouse);
+		});
+	});
+
+	Describe("Spatial navigation index", [this]()
+	{
+		BeforeEach([this]()
+		{
+			if (Menu != nullptr)
+			{
+				Environment->RemoveMenu(Menu);
+				CreateMenu(true);
+			}
+		});
+
+		It("should resolve navigation through the index", [this]()
+		{
+			if (Menu == nullptr)
+			{
+				return;
+			}
+
+			Environment->PressKey(EKeys::Down);
+			Environment->PressKey(EKeys::Down);
+
+			TestTrue(TEXT("Third component is current"), Menu->GetCurrentComponent() == GetComponent(2));
+		});
+	});
+
+	Describe("Rebinding", [this]()
+	{
+		It("should restore the original key when a transaction is rolled back", [this]()
+		{
+			const FName MappingName = Menu != nullptr ? FindMenuDownMappingName() : NAME_None;
+			if (MappingName.IsNone())
+			{
+				AddInfo(TEXT("Skipped: the UINav input context has no player mappable menu down mapping"));
+				return;
+			}
+
+			UUINavPCComponent* const UINavPC = Environment->GetUINavPC();
+			const FKey OriginalKey = GetMappedKey(MappingName);
+			FGameplayTagContainer FailureReason;
+
+			UINavPC->BeginRebindTransaction();
+			TestTrue(TEXT("Remapped to J"), UINavPC->RemapPlayerKey(MappingName, EKeys::J, FailureReason));
+			TestTrue(TEXT("Staged J"), GetMappedKey(MappingName) == EKeys::J);
+
+			UINavPC->RollbackRebindTransaction();
+			TestTrue(TEXT("Rollback restores the original key"), GetMappedKey(MappingName) == OriginalKey);
+			TestFalse(TEXT("Transaction is closed"), UINavPC->IsInRebindTransaction());
+		});
+
+		It("should restore the keys of a rolled back nested transaction", [this]()
+		{
+			const FName MappingName = Menu != nullptr ? FindMenuDownMappingName() : NAME_None;
+			if (MappingName.IsNone())
+			{
+				AddInfo(TEXT("Skipped: the UINav input context has no player mappable menu down mapping"));
+				return;
+			}
+
+			UUINavPCComponent* const UINavPC = Environment->GetUINavPC();
+			const FKey OriginalKey = GetMappedKey(MappingName);
+			FGameplayTagContainer FailureReason;
+
+			UINavPC->BeginRebindTransaction();
+			TestTrue(TEXT("Remapped to J"), UINavPC->RemapPlayerKey(MappingName, EKeys::J, FailureReason));
+
+			UINavPC->BeginRebindTransaction();
+			TestTrue(TEXT("Remapped to K"), UINavPC->RemapPlayerKey(MappingName, EKeys::K, FailureReason));
+			TestTrue(TEXT("Staged K"), GetMappedKey(MappingName) == EKeys::K);
+
+			UINavPC->RollbackRebindTransaction();
+			TestTrue(TEXT("Inner rollback restores J"), GetMappedKey(MappingName) == EKeys::J);
+			TestTrue(TEXT("Outer transaction is still open"), UINavPC->IsInRebindTransaction());
+
+			UINavPC->RollbackRebindTransaction();
+			TestTrue(TEXT("Outer rollback restores the original key"), GetMappedKey(MappingName) == OriginalKey);
+			TestFalse(TEXT("Transaction is closed"), UINavPC->IsInRebindTransaction());
+		});
+
+		It("should navigate with a committed rebind", [this]()
+		{
+			const FName MappingName = Menu != nullptr ? FindMenuDownMappingName() : NAME_None;
+			if (MappingName.IsNone())
+			{
+				AddInfo(TEXT("Skipped: the UINav input context has no player mappable menu down mapping"));
+				return;
+			}
+
+			UUINavPCComponent* const UINavPC = Environment->GetUINavPC();
+			const FKey OriginalKey = GetMappedKey(MappingName);
+			FGameplayTagContainer FailureReason;
+
+			UINavPC->BeginRebindTransaction();
+			TestTrue(TEXT("Remapped to J"), UINavPC->RemapPlayerKey(MappingName, EKeys::J, FailureReason));
+			UINavPC->CommitRebindTransaction();
+			Environment->Tick();
+
+			Environment->PressKey(EKeys::J);
+			TestTrue(TEXT("Second component is current"), Menu->GetCurrentComponent() == GetComponent(1));
+
+			if (OriginalKey.IsValid())
+			{
+				TestTrue(TEXT("Restored the original key"), UINavPC->RemapPlayerKey(MappingName, OriginalKey, FailureReason));
+			}
+		});
+	});
+
+	Describe("Input replay", [this]()
+	{
+		It("should replay recorded key, thumbstick and mouse input", [this]()
+		{
+			if (Menu == nullptr)
+			{
+				return;
+			}
+
+			FUINavTestInput KeyInput;
+			KeyInput.KeyPress(EKeys::Down);
+			TestTrue(TEXT("Replayed the key press"), Environment->Replay(KeyInput));
+			TestTrue(TEXT("Second component is current"), Menu->GetCurrentComponent() == GetComponent(1));
+			TestEqual(TEXT("Input type after the key press"), Environment->GetUINavPC()->GetCurrentInputType(), EInputType::Keyboard);
+
+			FUINavTestInput ThumbstickInput;
+			ThumbstickInput.Analog(EKeys::Gamepad_LeftY, -1.0f).Analog(EKeys::Gamepad_LeftY, 0.0f);
+			TestTrue(TEXT("Replayed the thumbstick"), Environment->Replay(ThumbstickInput));
+			TestTrue(TEXT("Third component is current"), Menu->GetCurrentComponent() == GetComponent(2));
+			TestEqual(TEXT("Input type after the thumbstick"), Environment->GetUINavPC()->GetCurrentInputType(), EInputType::Gamepad);
+
+			FUINavTestInput MouseInput;
+			MouseInput.MouseMove(FVector2D(10.0, 10.0), FVector2D(50.0, 50.0));
+			TestTrue(TEXT("Replayed the mouse move"), Environment->Replay(MouseInput));
+			TestEqual(TEXT("Input type after the mouse move"), Environment->GetUINavPC()->GetCurrentInputType(), EInputType::Mouse);
+		});
+
+		It("should ignore live input while replaying", [this]()
+		{
+			if (Menu == nullptr)
+			{
+				return;
+			}
+
+			// A replay of neutral thumbstick values, which doesn't navigate on its own
+			FUINavTestInput Input;
+			Input.Analog(EKeys::Gamepad_RightX, 0.0f).Analog(EKeys::Gamepad_RightX, 0.0f).Analog(EKeys::Gamepad_RightX, 0.0f);
+			if (!TestTrue(TEXT("Replay started"), Environment->StartReplay(Input)))
+			{
+				return;
+			}
+
+			Environment->PressKey(EKeys::Down);
+			Environment->Tick(Input.GetNumFrames() + 1);
+
+			TestFalse(TEXT("Replay finished"), Environment->GetUINavPC()->IsReplayingInput());
+			TestTrue(TEXT("First component is still current"), Menu->GetCurrentComponent() == GetComponent(0));
+		});
+	});
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
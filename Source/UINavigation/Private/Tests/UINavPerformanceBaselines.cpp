@@ -0,0 +1,138 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Tests/UINavPerformanceBaselines.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/Paths.h"
+
+namespace UINavPerformanceBaselines
+{
+	static TAutoConsoleVariable<bool> CVarUpdatePerformanceBaselines(
+		TEXT("UINav.Tests.UpdatePerformanceBaselines"),
+		false,
+		TEXT("Whether the UINav performance tests write their timings to the plugin's baselines file instead of checking against it."));
+
+	const TCHAR* const MillisecondsKey = TEXT("Milliseconds");
+	const TCHAR* const ToleranceKey = TEXT("Tolerance");
+
+	// The tolerance given to baselines recorded without one
+	constexpr double DefaultTolerance = 0.5;
+}
+
+void FUINavPerformanceBaselines::Check(FAutomationTestBase& Test, const FString& Name, const double Milliseconds)
+{
+	if (UINavPerformanceBaselines::CVarUpdatePerformanceBaselines.GetValueOnGameThread())
+	{
+		Save(Name, Milliseconds);
+		Test.AddInfo(FString::Printf(TEXT("%s: %.4f ms (written to %s)"), *Name, Milliseconds, *GetFilePath()));
+		return;
+	}
+
+	Load();
+
+	const FBaseline* const Baseline = Baselines.Find(Name);
+	if (Baseline == nullptr)
+	{
+		Test.AddError(FString::Printf(TEXT("%s: %.4f ms has no baseline in %s. Run with UINav.Tests.UpdatePerformanceBaselines=1 to record one."), *Name, Milliseconds, *GetFilePath()));
+		return;
+	}
+
+	const double MaxMilliseconds = Baseline->Milliseconds * (1.0 + Baseline->Tolerance);
+	if (Milliseconds > MaxMilliseconds)
+	{
+		Test.AddError(FString::Printf(TEXT("%s: %.4f ms exceeds the baseline of %.4f ms by more than %.0f%%"), *Name, Milliseconds, Baseline->Milliseconds, Baseline->Tolerance * 100.0));
+		return;
+	}
+
+	Test.AddInfo(FString::Printf(TEXT("%s: %.4f ms (baseline %.4f ms)"), *Name, Milliseconds, Baseline->Milliseconds));
+}
+
+double FUINavPerformanceBaselines::MeasureMilliseconds(const int32 NumSamples, TFunctionRef<void()> Function)
+{
+	Function();
+
+	TArray<double> Samples;
+	Samples.Reserve(NumSamples);
+	for (int32 i = 0; i < NumSamples; ++i)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		Function();
+		Samples.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+
+	if (Samples.Num() == 0)
+	{
+		return 0.0;
+	}
+
+	Samples.Sort();
+	return Samples[Samples.Num() / 2];
+}
+
+FString FUINavPerformanceBaselines::GetFilePath()
+{
+	const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("UINavigation"));
+	if (!Plugin.IsValid())
+	{
+		return FString();
+	}
+
+	return FPaths::ConvertRelativePathToFull(FPaths::Combine(Plugin->GetBaseDir(), TEXT("Config"), TEXT("UINavPerformanceBaselines.ini")));
+}
+
+void FUINavPerformanceBaselines::Load()
+{
+	if (bLoaded)
+	{
+		return;
+	}
+	bLoaded = true;
+
+	FConfigFile ConfigFile;
+	ConfigFile.Read(GetFilePath());
+
+	for (const TPair<FString, FConfigSection>& Section : AsConst(ConfigFile))
+	{
+		FString MillisecondsString;
+		if (!ConfigFile.GetString(*Section.Key, UINavPerformanceBaselines::MillisecondsKey, MillisecondsString) || !MillisecondsString.IsNumeric())
+		{
+			continue;
+		}
+
+		FBaseline& Baseline = Baselines.Add(Section.Key);
+		Baseline.Milliseconds = FCString::Atod(*MillisecondsString);
+
+		FString ToleranceString;
+		Baseline.Tolerance = ConfigFile.GetString(*Section.Key, UINavPerformanceBaselines::ToleranceKey, ToleranceString) && ToleranceString.IsNumeric() ?
+			FMath::Max(0.0, FCString::Atod(*ToleranceString)) :
+			UINavPerformanceBaselines::DefaultTolerance;
+	}
+}
+
+void FUINavPerformanceBaselines::Save(const FString& Name, const double Milliseconds)
+{
+	const FString FilePath = GetFilePath();
+
+	FConfigFile ConfigFile;
+	ConfigFile.Read(FilePath);
+
+	// Tolerances are kept, since they're tuned by hand for how noisy each timing is
+	FString ToleranceString;
+	if (!ConfigFile.GetString(*Name, UINavPerformanceBaselines::ToleranceKey, ToleranceString))
+	{
+		ConfigFile.SetString(*Name, UINavPerformanceBaselines::ToleranceKey, *FString::Printf(TEXT("%.2f"), UINavPerformanceBaselines::DefaultTolerance));
+	}
+	ConfigFile.SetString(*Name, UINavPerformanceBaselines::MillisecondsKey, *FString::Printf(TEXT("%.4f"), Milliseconds));
+
+	ConfigFile.Write(FilePath);
+	bLoaded = false;
+	Baselines.Reset();
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,55 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+
+class FAutomationTestBase;
+
+/**
+* Compares timings from the UINav performance tests against the baselines checked in at Config/UINavPerformanceBaselines.ini.
+* Each baseline has its own tolerance. A timing without a baseline fails, unless UINav.Tests.UpdatePerformanceBaselines is set,
+* in which case the timings are written back to that file to be reviewed and checked in.
+*/
+class FUINavPerformanceBaselines
+{
+public:
+
+	/**
+	*	Fails the given test if the timing exceeds its baseline by more than the baseline's tolerance
+	*
+	*	@param	Test  The test to report to
+	*	@param	Name  The name of the baseline, which is its section in the baselines file
+	*	@param	Milliseconds  The measured timing
+	*/
+	void Check(FAutomationTestBase& Test, const FString& Name, const double Milliseconds);
+
+	/**
+	*	Runs the given function once to warm up and then the given amount of times
+	*
+	*	@return  The median duration of the timed runs, in milliseconds
+	*/
+	static double MeasureMilliseconds(const int32 NumSamples, TFunctionRef<void()> Function);
+
+	static FString GetFilePath();
+
+private:
+
+	struct FBaseline
+	{
+		double Milliseconds = 0.0;
+		double Tolerance = 0.0;
+	};
+
+	void Load();
+
+	void Save(const FString& Name, const double Milliseconds);
+
+	TMap<FString, FBaseline> Baselines;
+
+	bool bLoaded = false;
+};
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,144 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Tests/UINavPerformanceBaselines.h"
+#include "Tests/UINavTestEnvironment.h"
+#include "UINavComponent.h"
+#include "UINavPCComponent.h"
+#include "UINavWidget.h"
+#include "Misc/AutomationTest.h"
+
+namespace UINavPerformanceSpec
+{
+	// As many components as fit in the test window, since Slate only navigates between widgets it laid out
+	constexpr int32 NumComponents = 14;
+	constexpr int32 NumSamples = 15;
+	constexpr int32 NumInputTypeCycles = 20;
+}
+
+BEGIN_DEFINE_SPEC(FUINavPerformanceSpec, "UINavigation.Performance", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+	TUniquePtr<FUINavTestEnvironment> Environment;
+	TUniquePtr<FUINavPerformanceBaselines> Baselines;
+
+	void CheckNavigation(const bool bUseSpatialNavigationIndex, const FString& BaselineName);
+
+END_DEFINE_SPEC(FUINavPerformanceSpec)
+
+void FUINavPerformanceSpec::CheckNavigation(const bool bUseSpatialNavigationIndex, const FString& BaselineName)
+{
+	UUINavWidget* const Menu = Environment->CreateMenu(UINavPerformanceSpec::NumComponents, bUseSpatialNavigationIndex);
+	if (!TestTrue(TEXT("Setup completed"), Environment->WaitForSetup(Menu)))
+	{
+		return;
+	}
+
+	const int32 NumNavigations = (UINavPerformanceSpec::NumComponents - 1) * 2;
+	const double Milliseconds = FUINavPerformanceBaselines::MeasureMilliseconds(UINavPerformanceSpec::NumSamples, [this]()
+	{
+		for (int32 i = 1; i < UINavPerformanceSpec::NumComponents; ++i)
+		{
+			Environment->PressKey(EKeys::Down);
+		}
+		for (int32 i = 1; i < UINavPerformanceSpec::NumComponents; ++i)
+		{
+			Environment->PressKey(EKeys::Up);
+		}
+	});
+
+	const TArray<UUINavComponent*> Components = FUINavTestEnvironment::GetMenuComponents(Menu);
+	TestTrue(TEXT("Navigated back to the first component"), Components.Num() > 0 && Menu->GetCurrentComponent() == Components[0]);
+
+	Baselines->Check(*this, BaselineName, Milliseconds / NumNavigations);
+	Environment->RemoveMenu(Menu);
+}
+
+void FUINavPerformanceSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Environment = MakeUnique<FUINavTestEnvironment>();
+		Baselines = MakeUnique<FUINavPerformanceBaselines>();
+		TestTrue(TEXT("Environment is valid"), Environment->IsValid());
+	});
+
+	AfterEach([this]()
+	{
+		Environment.Reset();
+		Baselines.Reset();
+	});
+
+	It("should set up a widget within its baseline", [this]()
+	{
+		if (!Environment->IsValid())
+		{
+			return;
+		}
+
+		bool bCompletedSetup = true;
+		const double Milliseconds = FUINavPerformanceBaselines::MeasureMilliseconds(UINavPerformanceSpec::NumSamples, [this, &bCompletedSetup]()
+		{
+			UUINavWidget* const Menu = Environment->CreateMenu(UINavPerformanceSpec::NumComponents);
+			bCompletedSetup &= Environment->WaitForSetup(Menu);
+			Environment->RemoveMenu(Menu);
+		});
+
+		TestTrue(TEXT("Setup completed"), bCompletedSetup);
+		Baselines->Check(*this, TEXT("Setup"), Milliseconds);
+	});
+
+	It("should navigate within its baseline", [this]()
+	{
+		if (!Environment->IsValid())
+		{
+			return;
+		}
+
+		CheckNavigation(false, TEXT("Navigation"));
+	});
+
+	It("should navigate through the spatial index within its baseline", [this]()
+	{
+		if (!Environment->IsValid())
+		{
+			return;
+		}
+
+		CheckNavigation(true, TEXT("SpatialIndexNavigation"));
+	});
+
+	It("should switch input types within its baseline", [this]()
+	{
+		if (!Environment->IsValid())
+		{
+			return;
+		}
+
+		UUINavWidget* const Menu = Environment->CreateMenu(UINavPerformanceSpec::NumComponents);
+		if (!TestTrue(TEXT("Setup completed"), Environment->WaitForSetup(Menu)))
+		{
+			return;
+		}
+
+		// Each cycle switches to gamepad, keyboard and mouse
+		constexpr int32 NumSwitches = UINavPerformanceSpec::NumInputTypeCycles * 3;
+		const double Milliseconds = FUINavPerformanceBaselines::MeasureMilliseconds(UINavPerformanceSpec::NumSamples, [this]()
+		{
+			for (int32 i = 0; i < UINavPerformanceSpec::NumInputTypeCycles; ++i)
+			{
+				Environment->SendAnalog(EKeys::Gamepad_RightX, 1.0f);
+				Environment->SendAnalog(EKeys::Gamepad_RightX, 0.0f);
+				Environment->PressKey(EKeys::LeftShift);
+				Environment->MoveMouse(FVector2D(10.0, 10.0), FVector2D(20.0, 20.0));
+			}
+		});
+
+		TestEqual(TEXT("Input type"), Environment->GetUINavPC()->GetCurrentInputType(), EInputType::Mouse);
+		Baselines->Check(*this, TEXT("InputTypeSwitch"), Milliseconds / NumSwitches);
+	});
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
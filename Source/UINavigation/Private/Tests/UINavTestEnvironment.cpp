@@ -0,0 +1,380 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#include "Tests/UINavTestEnvironment.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "UINavButtonBase.h"
+#include "UINavComponent.h"
+#include "UINavController.h"
+#include "UINavPCComponent.h"
+#include "UINavSectionButton.h"
+#include "UINavWidget.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/CanvasPanel.h"
+#include "Components/CanvasPanelSlot.h"
+#include "Components/Spacer.h"
+#include "Components/VerticalBox.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "Framework/Application/SlateApplication.h"
+#include "GenericPlatform/GenericPlatformInputDeviceMapper.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Widgets/SNullWidget.h"
+#include "Widgets/SWindow.h"
+
+namespace UINavTestEnvironment
+{
+	constexpr double FrameTime = 1.0 / 60.0;
+	const FVector2D WindowSize(1280.0, 720.0);
+	const FVector2D ListPosition(100.0, 100.0);
+	const FVector2D ComponentSize(240.0, 40.0);
+	const FVector2D SelectorSize(16.0, 16.0);
+
+	// Native user widgets don't get a widget tree from a blueprint, so it's created here when Initialize didn't
+	UWidgetTree* GetOrCreateWidgetTree(UUserWidget* Widget)
+	{
+		if (Widget->WidgetTree == nullptr)
+		{
+			Widget->WidgetTree = NewObject<UWidgetTree>(Widget, TEXT("WidgetTree"), RF_Transient);
+		}
+		return Widget->WidgetTree;
+	}
+
+	FKeyEvent MakeKeyEvent(const FKey& Key)
+	{
+		return FKeyEvent(Key,
+			FModifierKeysState(),
+			IPlatformInputDeviceMapper::Get().GetDefaultInputDevice(),
+			false,
+			0,
+			0,
+			0);
+	}
+
+	FAnalogInputEvent MakeAnalogEvent(const FKey& Key, const float Value)
+	{
+		return FAnalogInputEvent(Key,
+			FModifierKeysState(),
+			IPlatformInputDeviceMapper::Get().GetDefaultInputDevice(),
+			false,
+			0,
+			0,
+			Value,
+			0);
+	}
+
+	FPointerEvent MakeMouseMoveEvent(const FVector2D& From, const FVector2D& To)
+	{
+		return FPointerEvent(IPlatformInputDeviceMapper::Get().GetDefaultInputDevice(),
+			FSlateApplicationBase::CursorPointerIndex,
+			To,
+			From,
+			TSet<FKey>(),
+			EKeys::Invalid,
+			0.0f,
+			FModifierKeysState(),
+			0);
+	}
+}
+
+FUINavTestInput& FUINavTestInput::KeyPress(const FKey& Key)
+{
+	const FKeyEvent KeyEvent = UINavTestEnvironment::MakeKeyEvent(Key);
+	Recording.AddKeyEvent(EUINavRecordedInputType::KeyDown, GetTime(), Frame, KeyEvent);
+	++Frame;
+	Recording.AddKeyEvent(EUINavRecordedInputType::KeyUp, GetTime(), Frame, KeyEvent);
+	++Frame;
+	return *this;
+}
+
+FUINavTestInput& FUINavTestInput::Analog(const FKey& Key, const float Value)
+{
+	Recording.AddAnalogEvent(GetTime(), Frame, UINavTestEnvironment::MakeAnalogEvent(Key, Value));
+	++Frame;
+	return *this;
+}
+
+FUINavTestInput& FUINavTestInput::MouseMove(const FVector2D& From, const FVector2D& To)
+{
+	Recording.AddPointerEvent(EUINavRecordedInputType::MouseMove, GetTime(), Frame, UINavTestEnvironment::MakeMouseMoveEvent(From, To));
+	++Frame;
+	return *this;
+}
+
+double FUINavTestInput::GetTime() const
+{
+	return Frame * UINavTestEnvironment::FrameTime;
+}
+
+FUINavTestEnvironment::FUINavTestEnvironment()
+{
+	if (!FSlateApplication::IsInitialized() || GEngine == nullptr)
+	{
+		return;
+	}
+
+	FSlateApplication& SlateApplication = FSlateApplication::Get();
+	PreviousNavigationConfig = SlateApplication.GetNavigationConfig();
+
+	GameInstance = NewObject<UGameInstance>(GEngine);
+	GameInstance->InitializeStandalone();
+
+	FWorldContext* const WorldContext = GameInstance->GetWorldContext();
+	World = GameInstance->GetWorld();
+	if (WorldContext == nullptr || World == nullptr)
+	{
+		return;
+	}
+
+	// Local players need a viewport client, even if nothing is ever drawn through it
+	GameViewportClient = NewObject<UGameViewportClient>(GEngine);
+	GameViewportClient->Init(*WorldContext, GameInstance, false);
+	WorldContext->GameViewport = GameViewportClient;
+
+	World->InitializeActorsForPlay(FURL());
+
+	FString Error;
+	LocalPlayer = GameInstance->CreateLocalPlayer(IPlatformInputDeviceMapper::Get().GetPrimaryPlatformUser(), Error, false);
+	if (LocalPlayer == nullptr)
+	{
+		return;
+	}
+
+	Controller = World->SpawnActor<AUINavController>();
+	if (Controller == nullptr)
+	{
+		return;
+	}
+
+	Controller->SetPlayer(LocalPlayer);
+	World->GetWorldSettings()->NotifyBeginPlay();
+	UINavPC = Controller->FindComponentByClass<UUINavPCComponent>();
+
+	Window = SNew(SWindow)
+		.Title(FText::FromString(TEXT("UINavigation Tests")))
+		.ClientSize(UINavTestEnvironment::WindowSize)
+		.ScreenPosition(FVector2D::ZeroVector)
+		.AutoCenter(EAutoCenter::None)
+		.SizingRule(ESizingRule::FixedSize)
+		.SupportsMaximize(false)
+		.SupportsMinimize(false)
+		.ActivationPolicy(EWindowActivationPolicy::Always);
+	SlateApplication.AddWindow(Window.ToSharedRef());
+}
+
+FUINavTestEnvironment::~FUINavTestEnvironment()
+{
+	while (Menus.Num() > 0)
+	{
+		RemoveMenu(Menus.Last());
+	}
+
+	if (Window.IsValid() && FSlateApplication::IsInitialized())
+	{
+		FSlateApplication::Get().DestroyWindowImmediately(Window.ToSharedRef());
+	}
+
+	// Removes the local player, whose controller's UINavPCComponent unregisters its input processor when it ends play
+	if (GameInstance != nullptr)
+	{
+		GameInstance->Shutdown();
+	}
+
+	if (World != nullptr)
+	{
+		World->DestroyWorld(false);
+		GEngine->DestroyWorldContext(World);
+	}
+
+	if (PreviousNavigationConfig.IsValid() && FSlateApplication::IsInitialized())
+	{
+		FSlateApplication::Get().SetNavigationConfig(PreviousNavigationConfig.ToSharedRef());
+	}
+
+	IFileManager::Get().Delete(*GetReplayFilePath(), false, false, true);
+}
+
+bool FUINavTestEnvironment::IsValid() const
+{
+	return UINavPC != nullptr && Window.IsValid();
+}
+
+UUINavWidget* FUINavTestEnvironment::CreateMenu(const int32 NumComponents, const bool bUseSpatialNavigationIndex /*= false*/)
+{
+	if (!IsValid())
+	{
+		return nullptr;
+	}
+
+	UUINavWidget* const Menu = CreateWidget<UUINavWidget>(Controller.Get(), UUINavWidget::StaticClass());
+	if (Menu == nullptr)
+	{
+		return nullptr;
+	}
+	Menu->bUseSpatialNavigationIndex = bUseSpatialNavigationIndex;
+
+	UWidgetTree* const MenuTree = UINavTestEnvironment::GetOrCreateWidgetTree(Menu);
+	UCanvasPanel* const Root = MenuTree->ConstructWidget<UCanvasPanel>(UCanvasPanel::StaticClass(), TEXT("Root"));
+	MenuTree->RootWidget = Root;
+
+	UVerticalBox* const List = MenuTree->ConstructWidget<UVerticalBox>(UVerticalBox::StaticClass(), TEXT("List"));
+	UCanvasPanelSlot* const ListSlot = Root->AddChildToCanvas(List);
+	ListSlot->SetAutoSize(true);
+	ListSlot->SetPosition(UINavTestEnvironment::ListPosition);
+
+	for (int32 i = 0; i < NumComponents; ++i)
+	{
+		UUINavComponent* const Component = MenuTree->ConstructWidget<UUINavComponent>(UUINavComponent::StaticClass(), *FString::Printf(TEXT("Component%d"), i));
+		UWidgetTree* const ComponentTree = UINavTestEnvironment::GetOrCreateWidgetTree(Component);
+
+		UUINavButtonBase* const Button = ComponentTree->ConstructWidget<UUINavButtonBase>(UUINavButtonBase::StaticClass(), TEXT("NavButton"));
+		USpacer* const Content = ComponentTree->ConstructWidget<USpacer>(USpacer::StaticClass(), TEXT("Content"));
+		Content->SetSize(UINavTestEnvironment::ComponentSize);
+		Button->AddChild(Content);
+
+		ComponentTree->RootWidget = Button;
+		Component->NavButton = Button;
+		List->AddChildToVerticalBox(Component);
+	}
+
+	// Any native user widget can act as the selector. Having one makes the widget wait until it's laid out in the window before taking focus.
+	UUINavSectionButton* const Selector = MenuTree->ConstructWidget<UUINavSectionButton>(UUINavSectionButton::StaticClass(), TEXT("TheSelector"));
+	UWidgetTree* const SelectorTree = UINavTestEnvironment::GetOrCreateWidgetTree(Selector);
+	USpacer* const SelectorContent = SelectorTree->ConstructWidget<USpacer>(USpacer::StaticClass(), TEXT("Content"));
+	SelectorContent->SetSize(UINavTestEnvironment::SelectorSize);
+	SelectorTree->RootWidget = SelectorContent;
+	Root->AddChildToCanvas(Selector)->SetAutoSize(true);
+	Menu->TheSelector = Selector;
+
+	Menus.Add(Menu);
+	Window->SetContent(Menu->TakeWidget());
+	return Menu;
+}
+
+void FUINavTestEnvironment::RemoveMenu(UUINavWidget* Menu)
+{
+	if (Menus.Remove(Menu) == 0)
+	{
+		return;
+	}
+
+	// Releasing the menu's Slate widget destructs it
+	if (Window.IsValid() && Window->GetContent() == Menu->GetCachedWidget())
+	{
+		Window->SetContent(SNullWidget::NullWidget);
+	}
+	Menu->ReleaseSlateResources(true);
+}
+
+bool FUINavTestEnvironment::WaitForSetup(UUINavWidget* Menu, const int32 MaxFrames /*= 10*/)
+{
+	if (Menu == nullptr)
+	{
+		return false;
+	}
+
+	for (int32 Frame = 0; Frame < MaxFrames && !Menu->bCompletedSetup; ++Frame)
+	{
+		Tick();
+	}
+	return Menu->bCompletedSetup;
+}
+
+TArray<UUINavComponent*> FUINavTestEnvironment::GetMenuComponents(const UUINavWidget* Menu)
+{
+	TArray<UUINavComponent*> Components;
+	if (Menu == nullptr || Menu->WidgetTree == nullptr)
+	{
+		return Components;
+	}
+
+	Menu->WidgetTree->ForEachWidget([&Components](UWidget* Widget)
+	{
+		if (UUINavComponent* const Component = Cast<UUINavComponent>(Widget))
+		{
+			Components.Add(Component);
+		}
+	});
+	return Components;
+}
+
+void FUINavTestEnvironment::Tick(const int32 NumFrames /*= 1*/)
+{
+	FSlateApplication& SlateApplication = FSlateApplication::Get();
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		SlateApplication.Tick();
+	}
+}
+
+bool FUINavTestEnvironment::StartReplay(const FUINavTestInput& Input)
+{
+	if (!IsValid())
+	{
+		return false;
+	}
+
+	const FString FilePath = GetReplayFilePath();
+	return Input.GetRecording().SaveToFile(FilePath) && UINavPC->StartInputReplay(FilePath, true);
+}
+
+bool FUINavTestEnvironment::Replay(const FUINavTestInput& Input)
+{
+	if (!StartReplay(Input))
+	{
+		return false;
+	}
+
+	// The input processor replays a recorded frame each time Slate ticks it
+	const int32 MaxFrames = static_cast<int32>(Input.GetNumFrames()) + 1;
+	for (int32 Frame = 0; Frame < MaxFrames && UINavPC->IsReplayingInput(); ++Frame)
+	{
+		Tick();
+	}
+
+	// Selector updates wait for the layout, which happens at the end of the tick after the one that navigated
+	Tick();
+	return !UINavPC->IsReplayingInput();
+}
+
+void FUINavTestEnvironment::PressKey(const FKey& Key)
+{
+	FSlateApplication& SlateApplication = FSlateApplication::Get();
+	const FKeyEvent KeyEvent = UINavTestEnvironment::MakeKeyEvent(Key);
+	SlateApplication.ProcessKeyDownEvent(KeyEvent);
+	SlateApplication.ProcessKeyUpEvent(KeyEvent);
+}
+
+void FUINavTestEnvironment::SendAnalog(const FKey& Key, const float Value)
+{
+	FSlateApplication::Get().ProcessAnalogInputEvent(UINavTestEnvironment::MakeAnalogEvent(Key, Value));
+}
+
+void FUINavTestEnvironment::MoveMouse(const FVector2D& From, const FVector2D& To)
+{
+	FSlateApplication::Get().ProcessMouseMoveEvent(UINavTestEnvironment::MakeMouseMoveEvent(From, To));
+}
+
+void FUINavTestEnvironment::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObject(GameInstance);
+	Collector.AddReferencedObject(World);
+	Collector.AddReferencedObject(GameViewportClient);
+	Collector.AddReferencedObject(LocalPlayer);
+	Collector.AddReferencedObject(Controller);
+	Collector.AddReferencedObject(UINavPC);
+	Collector.AddReferencedObjects(Menus);
+}
+
+FString FUINavTestEnvironment::GetReplayFilePath() const
+{
+	return FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("UINavigation"), TEXT("TestInput.uinavinput")));
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
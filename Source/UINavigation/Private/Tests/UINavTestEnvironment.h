@@ -0,0 +1,137 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "InputCoreTypes.h"
+#include "Data/UINavInputRecording.h"
+#include "UObject/GCObject.h"
+
+class AUINavController;
+class SWindow;
+class UGameInstance;
+class UGameViewportClient;
+class ULocalPlayer;
+class UUINavComponent;
+class UUINavPCComponent;
+class UUINavWidget;
+class UWorld;
+class FNavigationConfig;
+
+/**
+* Builds synthetic input for the UINav automation tests, as a recording the UINav input processor can replay
+*/
+class FUINavTestInput
+{
+public:
+
+	// Presses the given key in one frame and releases it in the next
+	FUINavTestInput& KeyPress(const FKey& Key);
+
+	// Sets the given analog axis to the given value for one frame
+	FUINavTestInput& Analog(const FKey& Key, const float Value);
+
+	// Moves the mouse cursor between the given screen positions in one frame
+	FUINavTestInput& MouseMove(const FVector2D& From, const FVector2D& To);
+
+	const FUINavInputRecording& GetRecording() const { return Recording; }
+
+	uint32 GetNumFrames() const { return Frame; }
+
+private:
+
+	double GetTime() const;
+
+	FUINavInputRecording Recording;
+
+	uint32 Frame = 0;
+};
+
+/**
+* A standalone game world with a local player and an AUINavController, whose UINavWidgets are shown in their own Slate window.
+* This lets the UINav automation tests run without a map, a game viewport or a renderer (e.g. with -nullrhi).
+*/
+class FUINavTestEnvironment : public FGCObject
+{
+public:
+
+	FUINavTestEnvironment();
+
+	virtual ~FUINavTestEnvironment() override;
+
+	bool IsValid() const;
+
+	/**
+	*	Creates a UINavWidget with a vertical list of UINavComponents and a selector, and shows it in the test window
+	*
+	*	@param	NumComponents  The amount of components in the list
+	*	@param	bUseSpatialNavigationIndex  Whether the widget resolves navigation through its spatial index
+	*	@return  The widget, or nullptr if the environment isn't valid
+	*/
+	UUINavWidget* CreateMenu(const int32 NumComponents, const bool bUseSpatialNavigationIndex = false);
+
+	void RemoveMenu(UUINavWidget* Menu);
+
+	/**
+	*	Ticks Slate until the given widget completes its setup, which waits for it to be laid out
+	*
+	*	@return  Whether the setup completed
+	*/
+	bool WaitForSetup(UUINavWidget* Menu, const int32 MaxFrames = 10);
+
+	static TArray<UUINavComponent*> GetMenuComponents(const UUINavWidget* Menu);
+
+	void Tick(const int32 NumFrames = 1);
+
+	/**
+	*	Starts replaying the given input through the UINav input processor, one recorded frame per tick
+	*
+	*	@return  Whether the replay started
+	*/
+	bool StartReplay(const FUINavTestInput& Input);
+
+	/**
+	*	Replays the given input through the UINav input processor and ticks until it's done
+	*
+	*	@return  Whether the whole input was replayed
+	*/
+	bool Replay(const FUINavTestInput& Input);
+
+	// Dispatches the press and release of the given key through Slate right away
+	void PressKey(const FKey& Key);
+
+	// Dispatches the given analog value through Slate right away
+	void SendAnalog(const FKey& Key, const float Value);
+
+	// Dispatches a mouse move through Slate right away
+	void MoveMouse(const FVector2D& From, const FVector2D& To);
+
+	ULocalPlayer* GetLocalPlayer() const { return LocalPlayer; }
+
+	UUINavPCComponent* GetUINavPC() const { return UINavPC; }
+
+	//~ FGCObject interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FUINavTestEnvironment"); }
+
+private:
+
+	FString GetReplayFilePath() const;
+
+	TObjectPtr<UGameInstance> GameInstance = nullptr;
+	TObjectPtr<UWorld> World = nullptr;
+	TObjectPtr<UGameViewportClient> GameViewportClient = nullptr;
+	TObjectPtr<ULocalPlayer> LocalPlayer = nullptr;
+	TObjectPtr<AUINavController> Controller = nullptr;
+	TObjectPtr<UUINavPCComponent> UINavPC = nullptr;
+	TArray<TObjectPtr<UUINavWidget>> Menus;
+
+	TSharedPtr<SWindow> Window;
+
+	// The UINavPCComponent replaces Slate's navigation config, so the editor's is restored afterwards
+	TSharedPtr<FNavigationConfig> PreviousNavigationConfig;
+};
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -9,6 +9,7 @@
 #include "UINavComponent.h"
 #include "UINavMacros.h"
 #include "Data/PromptData.h"
+#include "Data/UINavKeyClassification.h"
 #include "InputAction.h"
 #include "EnhancedInputSubsystems.h"
 #include "Components/PanelWidget.h"
@@ -73,6 +74,12 @@ void UUINavBlueprintFunctionLibrary::ResetInputSettings(APlayerController* PC)
 {
 	if (IsValid(PC))
 	{
+		if (UUINavPCComponent* const UINavPC = PC->FindComponentByClass<UUINavPCComponent>())
+		{
+			UINavPC->ResetInputSettings();
+			return;
+		}
+
 		UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PC->GetLocalPlayer());
 		if (PC->InputComponent->IsA<UEnhancedInputComponent>() && Subsystem != nullptr)
 		{
@@ -97,43 +104,35 @@ void UUINavBlueprintFunctionLibrary::ResetInputSettings(APlayerController* PC)
 
 bool UUINavBlueprintFunctionLibrary::RespectsRestriction(const FKey Key, const EInputRestriction Restriction)
 {
-#if IS_VR_PLATFORM
-	const FString HMD = GEngine->XRSystem != nullptr ? GEngine->XRSystem->GetSystemName().ToString() : TEXT("");
-#else
-	const FString HMD = TEXT("");
-#endif
-	
-	switch (Restriction)
-	{
-	case EInputRestriction::None:
-		return true;
-	case EInputRestriction::Keyboard:
-		return (!Key.IsMouseButton() && !Key.IsGamepadKey());
-	case EInputRestriction::Mouse:
-		return Key.IsMouseButton();
-	case EInputRestriction::Keyboard_Mouse:
-		return !Key.IsGamepadKey();
-	case EInputRestriction::VR:
-		if (HMD == "") return false;
-		
-		if (HMD == "OculusHMD") {
-			return IsKeyInCategory(Key, "Oculus");
-		}
-		if (HMD == "Morpheus") {
-			return IsKeyInCategory(Key, "PSMove");
-		}
-		return false;
-	case EInputRestriction::Gamepad:
-		return (Key.IsGamepadKey() && !IsVRKey(Key));
-	}
+	return FUINavKeyClassification::RespectsRestriction(Key, Restriction);
+}
+
+namespace UINavStyledTextCache
+{
+	// Past this many entries the caches are cleared, so texts that are no longer shown don't pile up
+	constexpr int32 MaxEntries = 2048;
 
-	return false;
+	// Decorated texts by style row name and then by raw text
+	TMap<FString, TMap<FString, FText>> StyledTexts;
+	int32 NumStyledTexts = 0;
+
+	// What GetRawTextFromRichText returns for each decorated text built by ApplyStyleRowToText
+	TMap<FString, FText> RawTexts;
 }
 
 FText UUINavBlueprintFunctionLibrary::ApplyStyleRowToText(const FText& Text, const FString& StyleRowName)
 {
-	const FString TextString = Text.ToString();
-	
+	const FString& TextString = Text.ToString();
+
+	TMap<FString, FText>* RowTexts = UINavStyledTextCache::StyledTexts.Find(StyleRowName);
+	if (RowTexts != nullptr)
+	{
+		if (const FText* StyledText = RowTexts->Find(TextString))
+		{
+			return *StyledText;
+		}
+	}
+
 	TArray<FString> StringArray;
 	TextString.ParseIntoArray(StringArray, TEXT("\n"));
 	
@@ -143,12 +142,45 @@ FText UUINavBlueprintFunctionLibrary::ApplyStyleRowToText(const FText& Text, con
 		if (i > 0) FinalString += TEXT("\n");
 		FinalString += TEXT("<") + StyleRowName + TEXT(">") + StringArray[i].TrimEnd() + TEXT("</>");
 	}
+
+	if (UINavStyledTextCache::NumStyledTexts >= UINavStyledTextCache::MaxEntries)
+	{
+		UINavStyledTextCache::StyledTexts.Reset();
+		UINavStyledTextCache::RawTexts.Reset();
+		UINavStyledTextCache::NumStyledTexts = 0;
+		RowTexts = nullptr;
+	}
+
+	if (RowTexts == nullptr)
+	{
+		RowTexts = &UINavStyledTextCache::StyledTexts.Add(StyleRowName);
+	}
+
+	const FText StyledText = FText::FromString(FinalString);
+	RowTexts->Add(TextString, StyledText);
+	++UINavStyledTextCache::NumStyledTexts;
+
+	// GetRawTextFromRichText returns the contents of the first tag, which is the first line as long as it has no tag characters of its own
+	if (StringArray.Num() > 0 && !StyleRowName.Contains(TEXT(">")))
+	{
+		const FString FirstLine = StringArray[0].TrimEnd();
+		int32 TagCharIndex;
+		if (!FirstLine.FindChar(TCHAR('<'), TagCharIndex) && !FirstLine.FindChar(TCHAR('>'), TagCharIndex))
+		{
+			UINavStyledTextCache::RawTexts.Add(FinalString, FText::FromString(FirstLine));
+		}
+	}
 	
-	return FText::FromString(FinalString);
+	return StyledText;
 }
 
 FText UUINavBlueprintFunctionLibrary::GetRawTextFromRichText(const FText& RichText)
 {
+	if (const FText* RawText = UINavStyledTextCache::RawTexts.Find(RichText.ToString()))
+	{
+		return *RawText;
+	}
+
 	FString RichTextStr = RichText.ToString();
 
 	int32 StartIndex;
@@ -443,11 +475,16 @@ const UUINavSettings* UUINavBlueprintFunctionLibrary::GetUINavSettings()
 
 bool UUINavBlueprintFunctionLibrary::IsVRKey(const FKey Key)
 {
-	return IsKeyInCategory(Key, "Oculus") || IsKeyInCategory(Key, "Vive") ||
-		IsKeyInCategory(Key, "MixedReality") || IsKeyInCategory(Key, "Valve") || IsKeyInCategory(Key, "PSMove");
+	return (FUINavKeyClassification::GetKeyFlags(Key) & FUINavKeyClassification::VR) != 0;
 }
 
 bool UUINavBlueprintFunctionLibrary::IsKeyInCategory(const FKey Key, const FString Category)
 {
+	const uint16 CategoryFlag = FUINavKeyClassification::GetCategoryFlag(Category);
+	if (CategoryFlag != 0)
+	{
+		return (FUINavKeyClassification::GetKeyFlags(Key) & CategoryFlag) != 0;
+	}
+
 	return Key.ToString().Contains(Category);
 }
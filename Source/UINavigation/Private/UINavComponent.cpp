@@ -20,6 +20,20 @@
 #include "Templates/SharedPointer.h"
 #include "UINavigationConfig.h"
 
+namespace UINavComponent
+{
+	FSlateBrush* GetStyleBrush(FButtonStyle& Style, const EButtonStyle ButtonStyle)
+	{
+		switch (ButtonStyle)
+		{
+			case EButtonStyle::Normal: return &Style.Normal;
+			case EButtonStyle::Hovered: return &Style.Hovered;
+			case EButtonStyle::Pressed: return &Style.Pressed;
+			default: return nullptr;
+		}
+	}
+}
+
 UUINavComponent::UUINavComponent(const FObjectInitializer& ObjectInitializer)
 	:Super(ObjectInitializer)
 {
@@ -85,6 +99,11 @@ void UUINavComponent::NativeConstruct()
 	}
 
 	SetFocusable(IsFocusable() && GetIsEnabled());
+
+	if (IsValid(ParentWidget))
+	{
+		ParentWidget->UpdateSpatialIndex(this);
+	}
 }
 
 void UUINavComponent::NativeDestruct()
@@ -311,13 +330,21 @@ void UUINavComponent::ExecuteComponentActions(const EComponentAction Action)
 		return;
 	}
 
-	for (const UUINavComponentAction* const ActionObject : ActionObjects->Actions)
+	for (UUINavComponentAction* const ActionObject : ActionObjects->Actions)
 	{
 		if (!IsValid(ActionObject))
 		{
 			continue;
 		}
 
+		// Actions are instanced per component, so they can be executed directly unless they need a fresh copy every time
+		if (!ActionObject->bFreshInstancePerExecution)
+		{
+			ActionObject->ExecuteAction(this);
+			ActionObject->ResetAction();
+			continue;
+		}
+
 		UUINavComponentAction* DuplicatedAction = DuplicateObject<UUINavComponentAction>(ActionObject, ActionObject->GetOuter());
 		if (!IsValid(DuplicatedAction))
 		{
@@ -389,6 +416,19 @@ FNavigationReply UUINavComponent::NativeOnNavigation(const FGeometry& MyGeometry
 {
 	FNavigationReply Reply = Super::NativeOnNavigation(MyGeometry, InNavigationEvent, InDefaultReply);
 	UUINavWidget::HandleOnNavigation(Reply, ParentWidget, InNavigationEvent);
+
+	if (Reply.GetBoundaryRule() == EUINavigationRule::Escape && IsValid(ParentWidget) && ParentWidget->TryNavigateListView(this, InNavigationEvent.GetNavigationType()))
+	{
+		Reply = FNavigationReply::Stop();
+	}
+	else if (Reply.GetBoundaryRule() == EUINavigationRule::Escape && IsValid(ParentWidget) && ParentWidget->bUseSpatialNavigationIndex)
+	{
+		if (UUINavComponent* NextComponent = ParentWidget->FindComponentInDirection(this, InNavigationEvent.GetNavigationType()))
+		{
+			Reply = FNavigationReply::Explicit(NextComponent->NavButton->GetCachedWidget());
+		}
+	}
+
 	return Reply;
 }
 
@@ -472,56 +512,30 @@ void UUINavComponent::RevertButtonStyle()
 
 void UUINavComponent::SwapStyle(EButtonStyle Style1, EButtonStyle Style2)
 {
-	FButtonStyle Style = NavButton->GetStyle();
-	FSlateBrush TempState;
+	if (Style1 == Style2)
+	{
+		return;
+	}
 
-	switch (Style1)
+	// The Slate button keeps pointers to the brushes of the button's style, so swapping them in place only needs a repaint,
+	// unlike SetStyle which copies the whole style and invalidates the button's layout
+PRAGMA_DISABLE_DEPRECATION_WARNINGS
+	FButtonStyle& Style = NavButton->WidgetStyle;
+PRAGMA_ENABLE_DEPRECATION_WARNINGS
+
+	FSlateBrush* const Brush1 = UINavComponent::GetStyleBrush(Style, Style1);
+	FSlateBrush* const Brush2 = UINavComponent::GetStyleBrush(Style, Style2);
+	if (Brush1 == nullptr || Brush2 == nullptr)
 	{
-	case EButtonStyle::Normal:
-		TempState = Style.Normal;
-		switch (Style2)
-		{
-		case EButtonStyle::Hovered:
-			Style.Normal = Style.Hovered;
-			Style.Hovered = TempState;
-			break;
-		case EButtonStyle::Pressed:
-			Style.Normal = Style.Pressed;
-			Style.Pressed = TempState;
-			break;
-		}
-		break;
-	case EButtonStyle::Hovered:
-		TempState = Style.Hovered;
-		switch (Style2)
-		{
-		case EButtonStyle::Normal:
-			Style.Hovered = Style.Normal;
-			Style.Normal = TempState;
-			break;
-		case EButtonStyle::Pressed:
-			Style.Hovered = Style.Pressed;
-			Style.Pressed = TempState;
-			break;
-		}
-		break;
-	case EButtonStyle::Pressed:
-		TempState = Style.Pressed;
-		switch (Style2)
-		{
-		case EButtonStyle::Normal:
-			Style.Pressed = Style.Normal;
-			Style.Normal = TempState;
-			break;
-		case EButtonStyle::Hovered:
-			Style.Pressed = Style.Hovered;
-			Style.Hovered = TempState;
-			break;
-		}
-		break;
+		return;
 	}
 
-	NavButton->SetStyle(Style);
+	Swap(*Brush1, *Brush2);
+
+	if (const TSharedPtr<SWidget> ButtonWidget = NavButton->GetCachedWidget())
+	{
+		ButtonWidget->Invalidate(EInvalidateWidgetReason::Paint);
+	}
 }
 
 EButtonStyle UUINavComponent::GetStyleFromButtonState()
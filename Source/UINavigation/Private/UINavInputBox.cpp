@@ -91,14 +91,14 @@ void UUINavInputBox::CreateEnhancedInputKeyWidgets()
 		InputDisplay->SetVisibility(ESlateVisibility::Collapsed);
 		if (IsValid(NavText)) NavText->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
 		if (IsValid(NavRichText)) NavRichText->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
-		CurrentKey = FKey();
+		SetCurrentKey(FKey());
 	}
 }
 
 bool UUINavInputBox::TrySetupNewKey(const FKey& NewKey)
 {
 	if (!NewKey.IsValid()) return false;
-	CurrentKey = NewKey;
+	SetCurrentKey(NewKey);
 	
 	bUsingKeyDisplay = true;
 	InputDisplay->OverrideWithExactKey = CurrentKey;
@@ -118,12 +118,12 @@ void UUINavInputBox::OnInputTypeChanged(EInputType InputType)
 
 void UUINavInputBox::ResetKeyWidgets()
 {
-	CurrentKey = FKey();
+	SetCurrentKey(FKey());
 	bUsingKeyDisplay = false;
 	CreateKeyWidgets();
 }
 
-void UUINavInputBox::UpdateInputKey(const FKey& NewKey, const bool bSkipChecks)
+bool UUINavInputBox::UpdateInputKey(const FKey& NewKey, const bool bSkipChecks)
 {
 	AwaitingNewKey = NewKey;
 
@@ -134,23 +134,24 @@ void UUINavInputBox::UpdateInputKey(const FKey& NewKey, const bool bSkipChecks)
 		if (RevertReason != ERevertRebindReason::None)
 		{
 			CancelUpdateInputKey(RevertReason);
-			return;
+			return false;
 		}
 	}
 
 	return FinishUpdateNewKey();
 }
 
-void UUINavInputBox::FinishUpdateNewKey()
+bool UUINavInputBox::FinishUpdateNewKey()
 {
 	const FKey OldKey = CurrentKey;
-	FinishUpdateNewEnhancedInputKey(AwaitingNewKey);
+	const bool bRebound = FinishUpdateNewEnhancedInputKey(AwaitingNewKey);
 	OnKeyRebinded(InputName, OldKey, CurrentKey);
 	bAwaitingNewKey = false;
 	if (UINavPC->IsListeningToInputRebind())
 	{
 		UINavPC->CancelRebind();
 	}
+	return bRebound;
 }
 
 void UUINavInputBox::ResetToDefault()
@@ -186,59 +187,47 @@ void UUINavInputBox::ResetToDefault()
 }
 
 
-void UUINavInputBox::FinishUpdateNewEnhancedInputKey(const FKey& PressedKey)
+bool UUINavInputBox::FinishUpdateNewEnhancedInputKey(const FKey& PressedKey)
 {
 
-	if (!IsValid(UINavPC) || !IsValid(UINavPC->GetPC()) || !IsValid(UINavPC->GetPC()->GetLocalPlayer()))
-	{
-		return;
-	}
-	UEnhancedInputLocalPlayerSubsystem* PlayerSubsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(UINavPC->GetPC()->GetLocalPlayer());
-	if (!IsValid(PlayerSubsystem))
+	if (!IsValid(UINavPC))
 	{
-		return;
+		return false;
 	}
-	UEnhancedInputUserSettings* PlayerSettings = PlayerSubsystem->GetUserSettings();
-	if (!IsValid(PlayerSettings))
-	{
-		return;
-	}
-	FMapPlayerKeyArgs Args = {};
-	Args.MappingName = PlayerMappableKeySettingsName;
-	Args.Slot = EPlayerMappableKeySlot::First;
-	Args.NewKey = PressedKey;
+
+	// The input and its mirrors are rebound together, so a failed mirror doesn't leave the input half rebound
+	UINavPC->BeginRebindTransaction();
+
 	FGameplayTagContainer FailureReason;
-	PlayerSettings->MapPlayerKey(Args, FailureReason);
-	if (FailureReason.IsValid())
+	if (!UINavPC->RemapPlayerKey(PlayerMappableKeySettingsName, PressedKey, FailureReason))
 	{
+		UINavPC->RollbackRebindTransaction();
+		if (IsValid(InputContainer)) InputContainer->ForceUpdateInputBoxes();
 		FString Message = TEXT("Failed to rebind ");
 		Message.Append(*InputName.ToString());
 		Message.Append(TEXT(": "));
 		Message.Append(FailureReason.ToStringSimple(true));
 		DISPLAYERROR(Message);
-		return;
+		return false;
 	}
 	for (const FName Mirror : MirrorToPlayerMappableKeySettingsNames)
 	{
-		Args.MappingName = Mirror;
-		PlayerSettings->MapPlayerKey(Args, FailureReason);
-		if (FailureReason.IsValid())
+		if (!UINavPC->RemapPlayerKey(Mirror, PressedKey, FailureReason))
 		{
+			UINavPC->RollbackRebindTransaction();
+			if (IsValid(InputContainer)) InputContainer->ForceUpdateInputBoxes();
 			FString Message = TEXT("Failed to mirror to ");
 			Message.Append(*Mirror.ToString());
 			Message.Append(TEXT(": "));
 			Message.Append(FailureReason.ToStringSimple(true));
 			DISPLAYERROR(Message);
-			return;
+			return false;
 		}
 	}
-	
-	PlayerSettings->ApplySettings();
-	PlayerSettings->AsyncSaveSettings();
 
-	UINavPC->RequestRebuildMappings();
+	UINavPC->CommitRebindTransaction();
 
-	CurrentKey = PressedKey;
+	SetCurrentKey(PressedKey);
 	if (PressedKey.IsValid())
 	{
 		SetText(GetKeyText());
@@ -249,8 +238,9 @@ void UUINavInputBox::FinishUpdateNewEnhancedInputKey(const FKey& PressedKey)
 		InputDisplay->SetVisibility(ESlateVisibility::Collapsed);
 		if (IsValid(NavText)) NavText->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
 		if (IsValid(NavRichText)) NavRichText->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
-		CurrentKey = FKey();
+		SetCurrentKey(FKey());
 	}
+	return true;
 }
 
 void UUINavInputBox::CancelUpdateInputKey(const ERevertRebindReason Reason)
@@ -380,3 +370,13 @@ bool UUINavInputBox::ContainsKey(const FKey& CompareKey) const
 {
 	return CurrentKey == CompareKey;
 }
+
+void UUINavInputBox::SetCurrentKey(const FKey& NewKey)
+{
+	if (IsValid(InputContainer))
+	{
+		InputContainer->UpdateKeyIndex(this, CurrentKey, NewKey);
+	}
+
+	CurrentKey = NewKey;
+}
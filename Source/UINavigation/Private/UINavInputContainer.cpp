@@ -57,18 +57,32 @@ void UUINavInputContainer::NativeConstruct()
 		UINavPC->InputTypeChangedDelegate.AddUniqueDynamic(this, &UUINavInputContainer::OnInputTypeChanged);
 	}
 	
+	WhitelistedKeys = TSet<FKey>(KeyWhitelist);
+	BlacklistedKeys = TSet<FKey>(KeyBlacklist);
+
+	InputBoxes.Reset();
+	KeyInputBoxes.Reset();
 	WidgetTree->ForWidgetAndChildren(InputBoxesPanel, [this](UWidget* Widget)
 	{
 		if (UUINavInputBox* InputBox = Cast<UUINavInputBox>(Widget))
 		{
+			RegisterInputBox(InputBox);
 			InputBox->CreateKeyWidgets();
-			this->InputBoxes.Add(InputBox);
 		}
 	});
 
 	Super::NativeConstruct();
 }
 
+void UUINavInputContainer::RegisterInputBox(UUINavInputBox* InputBox)
+{
+	if (InputBox->EnhancedInputGroups.Num() == 0) InputBox->EnhancedInputGroups.Add(-1);
+
+	InputBox->InputContainer = this;
+	InputBox->InputContainerIndex = InputBoxes.Add(InputBox);
+	UpdateKeyIndex(InputBox, FKey(), InputBox->GetKey());
+}
+
 void UUINavInputContainer::NativeDestruct()
 {
 	if (IsValid(UINavPC))
@@ -123,7 +137,10 @@ bool UUINavInputContainer::RequestKeySwap(const FInputCollisionData& InputCollis
 
 void UUINavInputContainer::ResetKeyMappings()
 {
-	UUINavBlueprintFunctionLibrary::ResetInputSettings(Cast<APlayerController>(UINavPC->GetOwner()));
+	if (IsValid(UINavPC))
+	{
+		UINavPC->ResetInputSettings();
+	}
 	ForceUpdateInputBoxes();
 }
 
@@ -132,11 +149,38 @@ void UUINavInputContainer::ForceUpdateInputBoxes()
 	for (UUINavInputBox* InputBox : InputBoxes) InputBox->ResetKeyWidgets();
 }
 
+void UUINavInputContainer::BeginRebindTransaction()
+{
+	if (IsValid(UINavPC))
+	{
+		UINavPC->BeginRebindTransaction();
+	}
+}
+
+void UUINavInputContainer::CommitRebindTransaction(const bool bSaveNow /*= false*/)
+{
+	if (IsValid(UINavPC))
+	{
+		UINavPC->CommitRebindTransaction(bSaveNow);
+	}
+}
+
+void UUINavInputContainer::RollbackRebindTransaction()
+{
+	if (!IsValid(UINavPC) || !UINavPC->IsInRebindTransaction())
+	{
+		return;
+	}
+
+	UINavPC->RollbackRebindTransaction();
+	ForceUpdateInputBoxes();
+}
+
 ERevertRebindReason UUINavInputContainer::CanRegisterKey(UUINavInputBox * InputBox, const FKey NewKey, int& OutCollidingActionIndex)
 {
 	if (!NewKey.IsValid()) return ERevertRebindReason::BlacklistedKey;
-	if (KeyWhitelist.Num() > 0 && !KeyWhitelist.Contains(NewKey)) return ERevertRebindReason::NonWhitelistedKey;
-	if (KeyBlacklist.Contains(NewKey)) return ERevertRebindReason::BlacklistedKey;
+	if (WhitelistedKeys.Num() > 0 && !WhitelistedKeys.Contains(NewKey)) return ERevertRebindReason::NonWhitelistedKey;
+	if (BlacklistedKeys.Contains(NewKey)) return ERevertRebindReason::BlacklistedKey;
 	if (!UUINavBlueprintFunctionLibrary::RespectsRestriction(NewKey, InputBox->InputRestriction)) return ERevertRebindReason::RestrictionMismatch;
 	if (InputBox->ContainsKey(NewKey)) return ERevertRebindReason::UsedBySameInput;
 	if (!CanUseKey(InputBox, NewKey, OutCollidingActionIndex)) return ERevertRebindReason::UsedBySameInputGroup;
@@ -153,31 +197,59 @@ bool UUINavInputContainer::CanUseKey(UUINavInputBox* InputBox, const FKey Compar
 		return true;
 	}
 
-	for (int i = 0; i < InputBoxes.Num(); ++i)
+	const TArray<int32, TInlineAllocator<2>>* const KeyUsers = KeyInputBoxes.Find(CompareKey);
+	if (KeyUsers == nullptr)
+	{
+		return true;
+	}
+
+	for (const int i : *KeyUsers)
 	{
 		if (InputBox == InputBoxes[i]) continue;
-		
-		if (InputBoxes[i]->ContainsKey(CompareKey))
+
+		if (InputBox->EnhancedInputGroups.Contains(-1) ||
+			InputBoxes[i]->EnhancedInputGroups.Contains(-1))
+		{
+			OutCollidingActionIndex = i;
+			return false;
+		}
+
+		for (int InputGroup : InputBox->EnhancedInputGroups)
 		{
-			if (InputBox->EnhancedInputGroups.Contains(-1) ||
-				InputBoxes[i]->EnhancedInputGroups.Contains(-1))
+			if (InputBoxes[i]->EnhancedInputGroups.Contains(InputGroup))
 			{
 				OutCollidingActionIndex = i;
 				return false;
 			}
+		}
+	}
+
+	return true;
+}
 
-			for (int InputGroup : InputBox->EnhancedInputGroups)
+void UUINavInputContainer::UpdateKeyIndex(const UUINavInputBox* InputBox, const FKey& OldKey, const FKey& NewKey)
+{
+	if (!InputBoxes.IsValidIndex(InputBox->InputContainerIndex) || InputBoxes[InputBox->InputContainerIndex] != InputBox)
+	{
+		return;
+	}
+
+	if (OldKey.IsValid())
+	{
+		if (TArray<int32, TInlineAllocator<2>>* const OldKeyUsers = KeyInputBoxes.Find(OldKey))
+		{
+			OldKeyUsers->RemoveSingleSwap(InputBox->InputContainerIndex, EAllowShrinking::No);
+			if (OldKeyUsers->Num() == 0)
 			{
-				if (InputBoxes[i]->EnhancedInputGroups.Contains(InputGroup))
-				{
-					OutCollidingActionIndex = i;
-					return false;
-				}
+				KeyInputBoxes.Remove(OldKey);
 			}
 		}
 	}
 
-	return true;
+	if (NewKey.IsValid())
+	{
+		KeyInputBoxes.FindOrAdd(NewKey).AddUnique(InputBox->InputContainerIndex);
+	}
 }
 
 void UUINavInputContainer::OnInputTypeChanged(const EInputType InputType)
@@ -192,9 +264,15 @@ void UUINavInputContainer::SwapKeysDecided(const UPromptDataBase* const PromptDa
 	{
 		if (SwapKeysPromptData->bShouldSwap)
 		{
-			SwapKeysPromptData->CurrentInputBox->FinishUpdateNewKey();
-			SwapKeysPromptData->CollidingInputBox->UpdateInputKey(SwapKeysPromptData->InputCollisionData.CurrentInputKey,
-				true);
+			// Both rebinds are applied with a single mapping rebuild, or neither is if one of them fails
+			BeginRebindTransaction();
+			if (!SwapKeysPromptData->CurrentInputBox->FinishUpdateNewKey() ||
+				!SwapKeysPromptData->CollidingInputBox->UpdateInputKey(SwapKeysPromptData->InputCollisionData.CurrentInputKey, true))
+			{
+				RollbackRebindTransaction();
+				return;
+			}
+			CommitRebindTransaction();
 		}
 		else
 		{
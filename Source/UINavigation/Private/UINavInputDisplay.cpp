@@ -6,6 +6,7 @@
 #include "EnhancedInputSubsystems.h"
 #include "GameFramework/PlayerController.h"
 #include "UINavPCComponent.h"
+#include "UINavStats.h"
 #include "Engine/Texture2D.h"
 #include "Components/Image.h"
 #include "Components/TextBlock.h"
@@ -32,20 +33,18 @@ void UUINavInputDisplay::NativeConstruct()
 		return;
 	}
 
-	UINavPC->UpdateInputIconsDelegate.AddDynamic(this, &UUINavInputDisplay::UpdateInputVisuals);
+	UINavPC->RegisterInputDisplay(this);
 	
 	UpdateInputVisuals();
 }
 
 void UUINavInputDisplay::NativeDestruct()
 {
-	if (!IsValid(UINavPC))
+	if (IsValid(UINavPC))
 	{
-		return;
+		UINavPC->UnregisterInputDisplay(this);
 	}
 
-	UINavPC->UpdateInputIconsDelegate.RemoveDynamic(this, &UUINavInputDisplay::UpdateInputVisuals);
-
 	Super::NativeDestruct();
 }
 
@@ -85,8 +84,25 @@ void UUINavInputDisplay::NativePreConstruct()
 	}
 }
 
+void UUINavInputDisplay::MarkVisualsDirty()
+{
+	if (IsValid(UINavPC))
+	{
+		UINavPC->MarkInputDisplayDirty(this);
+	}
+}
+
+bool UUINavInputDisplay::IsOnScreen() const
+{
+	return GetCachedWidget().IsValid() && IsVisible();
+}
+
 void UUINavInputDisplay::UpdateInputVisuals()
 {
+	UINAV_SCOPE_CYCLE_COUNTER(STAT_UINavUpdateInputVisuals);
+
+	bVisualsDirty = false;
+
 	if (!IsValid(UINavPC))
 	{
 		return;
@@ -123,11 +139,32 @@ void UUINavInputDisplay::UpdateInputVisuals()
 		if (!Key.IsValid()) Key = UINavPC->GetEnhancedInputKey(InputAction, Axis, Scale, EInputRestriction::Keyboard_Mouse);
 	}
 
-	FInputIconMapping Icon = UINavPC->GetKeyIconMapping(Key);
-	UFont* Font = Icon.InputIconFont.LoadSynchronous();
-	if (DisplayType != EInputDisplayType::Text && IsValid(Font) && IsValid(InputIconText))
+	// Icons of displays on screen are streamed in first, and the display queues an update once they're loaded
+	const bool bLoadAsync = GetDefault<UUINavSettings>()->bLoadInputIconsAsync;
+	const bool bHighPriority = IsOnScreen();
+	const FSimpleDelegate OnIconLoaded = FSimpleDelegate::CreateUObject(this, &UUINavInputDisplay::MarkVisualsDirty);
+
+	const FInputIconMapping Icon = UINavPC->GetKeyIconMapping(Key);
+	UFont* Font = nullptr;
+	if (DisplayType != EInputDisplayType::Text && IsValid(InputIconText) && !Icon.InputIconFont.IsNull())
+	{
+		if (bLoadAsync)
+		{
+			Font = UINavPC->RequestKeyIconFont(Key, bHighPriority, OnIconLoaded);
+		}
+		else
+		{
+			INC_DWORD_STAT(STAT_UINavInputIconsLoadedSynchronously);
+			Font = Icon.InputIconFont.LoadSynchronous();
+		}
+		if (!IsValid(Font) && UINavPC->IsKeyIconAssetLoading(Icon.InputIconFont.ToSoftObjectPath()))
+		{
+			return;
+		}
+	}
+
+	if (IsValid(Font))
 	{
-		
 		FSlateFontInfo FontInfo(Font, InputIconText->GetFont().Size);
 		FontInfo.OutlineSettings = InputIconText->GetFont().OutlineSettings;
 		InputIconText->SetFont(FontInfo);
@@ -136,18 +173,29 @@ void UUINavInputDisplay::UpdateInputVisuals()
 		return;
 	}
 	
-	TSoftObjectPtr<UTexture2D> NewSoftTexture = GetDefault<UUINavSettings>()->bLoadInputIconsAsync ?
-		UINavPC->GetSoftKeyIcon(Key) : UINavPC->GetKeyIcon(Key);
-		
+	const TSoftObjectPtr<UTexture2D>& NewSoftTexture = Icon.InputIcon;
 	if (!NewSoftTexture.IsNull() && DisplayType != EInputDisplayType::Text)
 	{
-		InputImage->SetBrushFromSoftTexture(NewSoftTexture, bMatchIconSize);
-		if (!bMatchIconSize)
+		UTexture2D* NewTexture = nullptr;
+		if (bLoadAsync)
 		{
-			InputImage->SetDesiredSizeOverride(IconSize);
+			NewTexture = UINavPC->RequestKeyIcon(Key, bHighPriority, OnIconLoaded);
 		}
+		else
+		{
+			INC_DWORD_STAT(STAT_UINavInputIconsLoadedSynchronously);
+			NewTexture = NewSoftTexture.LoadSynchronous();
+		}
+		if (IsValid(NewTexture))
+		{
+			InputImage->SetBrushFromTexture(NewTexture, bMatchIconSize);
+			if (!bMatchIconSize)
+			{
+				InputImage->SetDesiredSizeOverride(IconSize);
+			}
 
-		InputImage->SetVisibility(ESlateVisibility::Visible);
+			InputImage->SetVisibility(ESlateVisibility::Visible);
+		}
 	}
 	if (NewSoftTexture.IsNull() || DisplayType != EInputDisplayType::Icon)
 	{
@@ -3,12 +3,130 @@
 #include "UINavInputProcessor.h"
 #include "UINavPCComponent.h"
 
+void FUINavInputProcessor::StartRecording()
+{
+	Recording.Reset();
+	RecordingStartTime = FPlatformTime::Seconds();
+	RecordingStartFrame = GFrameCounter;
+	bRecording = true;
+}
+
+bool FUINavInputProcessor::StopRecording(const FString& FilePath)
+{
+	if (!bRecording)
+	{
+		return false;
+	}
+
+	bRecording = false;
+	const bool bSaved = Recording.SaveToFile(FilePath);
+	Recording.Reset();
+	return bSaved;
+}
+
+bool FUINavInputProcessor::StartReplay(const FString& FilePath, const bool bAtMaxSpeed)
+{
+	StopReplay();
+
+	if (!Replay.LoadFromFile(FilePath))
+	{
+		return false;
+	}
+
+	ReplayEventIndex = 0;
+	ReplayStartTime = FPlatformTime::Seconds();
+	bReplayAtMaxSpeed = bAtMaxSpeed;
+	return true;
+}
+
+void FUINavInputProcessor::StopReplay()
+{
+	ReplayEventIndex = INDEX_NONE;
+	Replay.Reset();
+}
+
 void FUINavInputProcessor::Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor)
 {
+	if (IsReplaying())
+	{
+		TickReplay(SlateApp);
+	}
+}
+
+void FUINavInputProcessor::TickReplay(FSlateApplication& SlateApp)
+{
+	const TArray<FUINavRecordedInputEvent>& Events = Replay.GetEvents();
+	if (!Events.IsValidIndex(ReplayEventIndex))
+	{
+		StopReplay();
+		return;
+	}
+
+	// At maximum speed, each tick replays the events of a single recorded frame
+	const uint32 ReplayFrame = Events[ReplayEventIndex].Frame;
+	const double ReplayTime = FPlatformTime::Seconds() - ReplayStartTime;
+
+	TGuardValue<bool> DispatchGuard(bDispatchingReplayEvent, true);
+	while (Events.IsValidIndex(ReplayEventIndex))
+	{
+		const FUINavRecordedInputEvent& Event = Events[ReplayEventIndex];
+		if (bReplayAtMaxSpeed ? Event.Frame != ReplayFrame : Event.Time > ReplayTime)
+		{
+			break;
+		}
+
+		++ReplayEventIndex;
+		DispatchReplayEvent(SlateApp, Event);
+	}
+
+	if (!Events.IsValidIndex(ReplayEventIndex))
+	{
+		StopReplay();
+	}
+}
+
+void FUINavInputProcessor::DispatchReplayEvent(FSlateApplication& SlateApp, const FUINavRecordedInputEvent& Event)
+{
+	switch (Event.Type)
+	{
+		case EUINavRecordedInputType::KeyDown:
+			SlateApp.ProcessKeyDownEvent(Replay.MakeKeyEvent(Event));
+			break;
+		case EUINavRecordedInputType::KeyUp:
+			SlateApp.ProcessKeyUpEvent(Replay.MakeKeyEvent(Event));
+			break;
+		case EUINavRecordedInputType::Analog:
+			SlateApp.ProcessAnalogInputEvent(Replay.MakeAnalogEvent(Event));
+			break;
+		case EUINavRecordedInputType::MouseMove:
+			SlateApp.ProcessMouseMoveEvent(Replay.MakePointerEvent(Event));
+			break;
+		case EUINavRecordedInputType::MouseButtonDown:
+			SlateApp.ProcessMouseButtonDownEvent(nullptr, Replay.MakePointerEvent(Event));
+			break;
+		case EUINavRecordedInputType::MouseButtonUp:
+			SlateApp.ProcessMouseButtonUpEvent(Replay.MakePointerEvent(Event));
+			break;
+		case EUINavRecordedInputType::MouseButtonDoubleClick:
+			SlateApp.ProcessMouseButtonDoubleClickEvent(nullptr, Replay.MakePointerEvent(Event));
+			break;
+		case EUINavRecordedInputType::MouseWheel:
+			SlateApp.ProcessMouseWheelOrGestureEvent(Replay.MakePointerEvent(Event), nullptr);
+			break;
+	}
 }
 
 bool FUINavInputProcessor::HandleKeyDownEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
 {
+	if (ShouldBlockLiveInput())
+	{
+		return true;
+	}
+	if (bRecording)
+	{
+		Recording.AddKeyEvent(EUINavRecordedInputType::KeyDown, GetRecordingTime(), GetRecordingFrame(), InKeyEvent);
+	}
+
 	if (UINavPC != nullptr)
 	{
 		if (UINavPC->IsListeningToInputRebind())
@@ -24,6 +142,15 @@ bool FUINavInputProcessor::HandleKeyDownEvent(FSlateApplication& SlateApp, const
 
 bool FUINavInputProcessor::HandleKeyUpEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
 {
+	if (ShouldBlockLiveInput())
+	{
+		return true;
+	}
+	if (bRecording)
+	{
+		Recording.AddKeyEvent(EUINavRecordedInputType::KeyUp, GetRecordingTime(), GetRecordingFrame(), InKeyEvent);
+	}
+
 	if (UINavPC != nullptr)
 	{
 		UINavPC->HandleKeyUpEvent(SlateApp, InKeyEvent);
@@ -34,6 +161,15 @@ bool FUINavInputProcessor::HandleKeyUpEvent(FSlateApplication& SlateApp, const F
 
 bool FUINavInputProcessor::HandleAnalogInputEvent(FSlateApplication& SlateApp, const FAnalogInputEvent& InAnalogInputEvent)
 {
+	if (ShouldBlockLiveInput())
+	{
+		return true;
+	}
+	if (bRecording)
+	{
+		Recording.AddAnalogEvent(GetRecordingTime(), GetRecordingFrame(), InAnalogInputEvent);
+	}
+
 	if (UINavPC != nullptr)
 	{
 		UINavPC->HandleAnalogInputEvent(SlateApp, InAnalogInputEvent);
@@ -44,6 +180,15 @@ bool FUINavInputProcessor::HandleAnalogInputEvent(FSlateApplication& SlateApp, c
 
 bool FUINavInputProcessor::HandleMouseMoveEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
 {
+	if (ShouldBlockLiveInput())
+	{
+		return true;
+	}
+	if (bRecording)
+	{
+		Recording.AddPointerEvent(EUINavRecordedInputType::MouseMove, GetRecordingTime(), GetRecordingFrame(), MouseEvent);
+	}
+
 	if (UINavPC != nullptr)
 	{
 		UINavPC->HandleMouseMoveEvent(SlateApp, MouseEvent);
@@ -54,6 +199,15 @@ bool FUINavInputProcessor::HandleMouseMoveEvent(FSlateApplication& SlateApp, con
 
 bool FUINavInputProcessor::HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
 {
+	if (ShouldBlockLiveInput())
+	{
+		return true;
+	}
+	if (bRecording)
+	{
+		Recording.AddPointerEvent(EUINavRecordedInputType::MouseButtonDown, GetRecordingTime(), GetRecordingFrame(), MouseEvent);
+	}
+
 	if (UINavPC != nullptr)
 	{
 		EInputType InputType = UINavPC->CurrentInputType;
@@ -75,6 +229,15 @@ bool FUINavInputProcessor::HandleMouseButtonDownEvent(FSlateApplication& SlateAp
 
 bool FUINavInputProcessor::HandleMouseButtonUpEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
 {
+	if (ShouldBlockLiveInput())
+	{
+		return true;
+	}
+	if (bRecording)
+	{
+		Recording.AddPointerEvent(EUINavRecordedInputType::MouseButtonUp, GetRecordingTime(), GetRecordingFrame(), MouseEvent);
+	}
+
 	if (UINavPC != nullptr)
 	{
 		EInputType InputType = UINavPC->CurrentInputType;
@@ -90,6 +253,15 @@ bool FUINavInputProcessor::HandleMouseButtonUpEvent(FSlateApplication& SlateApp,
 
 bool FUINavInputProcessor::HandleMouseButtonDoubleClickEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
 {
+	if (ShouldBlockLiveInput())
+	{
+		return true;
+	}
+	if (bRecording)
+	{
+		Recording.AddPointerEvent(EUINavRecordedInputType::MouseButtonDoubleClick, GetRecordingTime(), GetRecordingFrame(), MouseEvent);
+	}
+
 	if (UINavPC != nullptr)
 	{
 		EInputType InputType = UINavPC->CurrentInputType;
@@ -124,6 +296,14 @@ bool FUINavInputProcessor::HandleMouseWheelOrGestureEvent(FSlateApplication& Sla
 		}
 		return true;
 	}
+	if (ShouldBlockLiveInput())
+	{
+		return true;
+	}
+	if (bRecording)
+	{
+		Recording.AddPointerEvent(EUINavRecordedInputType::MouseWheel, GetRecordingTime(), GetRecordingFrame(), InWheelEvent);
+	}
 	if (UINavPC != nullptr)
 	{
 		if (UINavPC->IsListeningToInputRebind())
@@ -10,6 +10,7 @@
 #include "UINavInputBox.h"
 #include "UINavInputDisplay.h"
 #include "UINavigationConfig.h"
+#include "UINavStats.h"
 #include "SwapKeysWidget.h"
 #include "Components/ScrollBox.h"
 #include "GameFramework/InputSettings.h"
@@ -32,11 +33,17 @@
 #include "PlayerMappableKeySettings.h"
 #include "EnhancedActionKeyMapping.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "Templates/SharedPointer.h"
 #include "Engine/GameViewportClient.h"
 #include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
 #include "Engine/Texture2D.h"
+#include "Engine/Font.h"
 #include "UObject/SoftObjectPtr.h"
+#include "Misc/Paths.h"
 #include "Internationalization/Internationalization.h"
 #include "UINavGameViewportClient.h"
 #include "Curves/CurveFloat.h"
@@ -175,7 +182,16 @@ void UUINavPCComponent::BeginPlay()
 
 void UUINavPCComponent::OnControlMappingsRebuilt()
 {
-	RefreshNavigationKeys();
+	const bool bNavigationKeysUpToDate = bRebuildRequestedAfterRebind && !bRebuildRequestedWithStaleNavigationKeys;
+	bRebuildRequestedAfterRebind = false;
+	bRebuildRequestedWithStaleNavigationKeys = false;
+
+	InvalidateInputKeyCache();
+	if (!bNavigationKeysUpToDate)
+	{
+		RefreshNavigationKeys();
+	}
+	ForceUpdateAllInputDisplays();
 	UpdateInputIconsDelegate.Broadcast();
 }
 
@@ -193,6 +209,31 @@ void UUINavPCComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	
 	IPlatformInputDeviceMapper::Get().GetOnInputDeviceConnectionChange().RemoveAll(this);
 
+	if (GameInputContextsHandle.IsValid())
+	{
+		GameInputContextsHandle->CancelHandle();
+		GameInputContextsHandle.Reset();
+	}
+
+	ClearWidgetPool();
+
+	for (TPair<FSoftObjectPath, FUINavKeyIconLoad>& PendingLoad : PendingKeyIconLoads)
+	{
+		if (PendingLoad.Value.Handle.IsValid())
+		{
+			PendingLoad.Value.Handle->CancelHandle();
+		}
+	}
+	PendingKeyIconLoads.Empty();
+	ClearResidentKeyIcons();
+
+	// Staged rebinds were never committed, so none of them should be saved
+	while (IsInRebindTransaction())
+	{
+		RollbackRebindTransaction();
+	}
+	SaveInputSettings();
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -200,6 +241,17 @@ void UUINavPCComponent::TickComponent(float DeltaTime, ELevelTick TickType, FAct
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	UpdateDirtyInputDisplays();
+
+	if (InputSettingsSaveCountdown >= 0.0f)
+	{
+		InputSettingsSaveCountdown -= DeltaTime;
+		if (InputSettingsSaveCountdown < 0.0f)
+		{
+			SaveInputSettings();
+		}
+	}
+
 	if (bChainNavigation)
 	{
 		switch (CountdownPhase)
@@ -280,6 +332,33 @@ void UUINavPCComponent::TickComponent(float DeltaTime, ELevelTick TickType, FAct
 		bIgnoreFocusByNavigation = false;
 	}
 
+	UpdateUsingThumbstickAsMouse();
+
+	if (!NeedsTick())
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
+bool UUINavPCComponent::NeedsTick() const
+{
+	return DirtyInputDisplays.Num() > 0 ||
+		InputSettingsSaveCountdown >= 0.0f ||
+		(bChainNavigation && CountdownPhase != ECountdownPhase::None) ||
+		bReceivedAnalogInput ||
+		ThumbstickDelta != FVector2D::ZeroVector;
+}
+
+void UUINavPCComponent::RequestTick()
+{
+	if (!IsComponentTickEnabled() && IsValid(PC) && PC->IsLocalController())
+	{
+		SetComponentTickEnabled(true);
+	}
+}
+
+void UUINavPCComponent::UpdateUsingThumbstickAsMouse()
+{
 	if (UsingThumbstickAsMouse() != EThumbstickAsMouse::None != bUsingThumbstickAsMouse)
 	{
 		bUsingThumbstickAsMouse = !bUsingThumbstickAsMouse;
@@ -287,8 +366,19 @@ void UUINavPCComponent::TickComponent(float DeltaTime, ELevelTick TickType, FAct
 	}
 }
 
-void UUINavPCComponent::RequestRebuildMappings()
+void UUINavPCComponent::RequestRebuildMappings(const bool bNavigationKeysUpToDate /*= false*/)
 {
+	if (bNavigationKeysUpToDate)
+	{
+		bRebuildRequestedAfterRebind = true;
+	}
+	else
+	{
+		bRebuildRequestedWithStaleNavigationKeys = true;
+	}
+
+	InvalidateInputKeyCache();
+
 	UEnhancedInputLibrary::ForEachSubsystem([](IEnhancedInputSubsystemInterface* Subsystem)
 	{
 		if (Subsystem)
@@ -298,6 +388,340 @@ void UUINavPCComponent::RequestRebuildMappings()
 	});
 }
 
+bool UUINavPCComponent::RemapPlayerKey(const FName PlayerMappableKeySettingsName, const FKey& NewKey, FGameplayTagContainer& OutFailureReason)
+{
+	UEnhancedInputUserSettings* const UserSettings = GetInputUserSettings();
+	if (!IsValid(UserSettings))
+	{
+		return false;
+	}
+
+	const FPlayerKeyMapping* const CurrentMapping = UserSettings->FindCurrentMappingForSlot(PlayerMappableKeySettingsName, EPlayerMappableKeySlot::First);
+	const FKey OldKey = CurrentMapping != nullptr ? CurrentMapping->GetCurrentKey() : FKey();
+
+	FMapPlayerKeyArgs Args = {};
+	Args.MappingName = PlayerMappableKeySettingsName;
+	Args.Slot = EPlayerMappableKeySlot::First;
+	Args.NewKey = NewKey;
+	UserSettings->MapPlayerKey(Args, OutFailureReason);
+	if (OutFailureReason.IsValid())
+	{
+		return false;
+	}
+
+	if (IsInRebindTransaction())
+	{
+		StagedRebinds.Add(FUINavStagedRebind{ PlayerMappableKeySettingsName, OldKey, NewKey });
+
+		InvalidateInputKeyCache();
+		return true;
+	}
+
+	UserSettings->ApplySettings();
+	ApplyNavigationKeyRebind(PlayerMappableKeySettingsName, OldKey, NewKey);
+	RequestRebuildMappings(true);
+	ScheduleSaveInputSettings();
+	return true;
+}
+
+void UUINavPCComponent::BeginRebindTransaction()
+{
+	RebindTransactionSavepoints.Add(StagedRebinds.Num());
+}
+
+void UUINavPCComponent::CommitRebindTransaction(const bool bSaveNow /*= false*/)
+{
+	if (!IsInRebindTransaction())
+	{
+		return;
+	}
+
+	// Committing a nested transaction hands its rebinds over to the outer one
+	RebindTransactionSavepoints.Pop(EAllowShrinking::No);
+	if (IsInRebindTransaction())
+	{
+		return;
+	}
+
+	if (StagedRebinds.Num() > 0)
+	{
+		if (UEnhancedInputUserSettings* const UserSettings = GetInputUserSettings())
+		{
+			UserSettings->ApplySettings();
+		}
+
+		for (const FUINavStagedRebind& StagedRebind : StagedRebinds)
+		{
+			ApplyNavigationKeyRebind(StagedRebind.PlayerMappableKeySettingsName, StagedRebind.PreviousKey, StagedRebind.NewKey);
+		}
+		StagedRebinds.Empty();
+
+		RequestRebuildMappings(true);
+		ScheduleSaveInputSettings();
+	}
+
+	if (bSaveNow)
+	{
+		SaveInputSettings();
+	}
+}
+
+void UUINavPCComponent::RollbackRebindTransaction()
+{
+	if (!IsInRebindTransaction())
+	{
+		return;
+	}
+
+	const int32 Savepoint = RebindTransactionSavepoints.Pop(EAllowShrinking::No);
+	if (StagedRebinds.Num() == Savepoint)
+	{
+		return;
+	}
+
+	if (UEnhancedInputUserSettings* const UserSettings = GetInputUserSettings())
+	{
+		// Reverted newest first, so a mapping rebound several times ends up with the key it had before this transaction
+		for (int32 i = StagedRebinds.Num() - 1; i >= Savepoint; --i)
+		{
+			const FUINavStagedRebind& StagedRebind = StagedRebinds[i];
+			FMapPlayerKeyArgs Args = {};
+			Args.MappingName = StagedRebind.PlayerMappableKeySettingsName;
+			Args.Slot = EPlayerMappableKeySlot::First;
+			Args.NewKey = StagedRebind.PreviousKey;
+			FGameplayTagContainer FailureReason;
+			if (StagedRebind.PreviousKey.IsValid())
+			{
+				UserSettings->MapPlayerKey(Args, FailureReason);
+			}
+			else
+			{
+				UserSettings->UnMapPlayerKey(Args, FailureReason);
+			}
+		}
+	}
+
+	StagedRebinds.SetNum(Savepoint, EAllowShrinking::No);
+	InvalidateInputKeyCache();
+	ForceUpdateAllInputDisplays();
+}
+
+void UUINavPCComponent::ResetInputSettings()
+{
+	// Resetting overrides anything staged, and any later commit of these transactions would find nothing to apply
+	while (IsInRebindTransaction())
+	{
+		RollbackRebindTransaction();
+	}
+
+	UEnhancedInputUserSettings* const UserSettings = GetInputUserSettings();
+	if (!IsValid(UserSettings) || !IsValid(UserSettings->GetCurrentKeyProfile()))
+	{
+		return;
+	}
+
+	FGameplayTagContainer FailureReason;
+	UserSettings->ResetKeyProfileToDefault(UserSettings->GetCurrentKeyProfile()->GetProfileIdentifer(), FailureReason);
+	if (FailureReason.IsValid())
+	{
+		FString Message = TEXT("Failed to reset keybindings: ");
+		Message.Append(FailureReason.ToStringSimple(true));
+		DISPLAYERROR(Message);
+	}
+
+	UserSettings->ApplySettings();
+	RequestRebuildMappings();
+	ScheduleSaveInputSettings();
+}
+
+void UUINavPCComponent::SaveInputSettings()
+{
+	if (InputSettingsSaveCountdown < 0.0f)
+	{
+		return;
+	}
+
+	InputSettingsSaveCountdown = -1.0f;
+	if (UEnhancedInputUserSettings* const UserSettings = GetInputUserSettings())
+	{
+		UserSettings->AsyncSaveSettings();
+	}
+}
+
+void UUINavPCComponent::ScheduleSaveInputSettings()
+{
+	InputSettingsSaveCountdown = GetDefault<UUINavSettings>()->InputSettingsSaveDelay;
+	if (InputSettingsSaveCountdown <= 0.0f)
+	{
+		InputSettingsSaveCountdown = 0.0f;
+		SaveInputSettings();
+		return;
+	}
+
+	RequestTick();
+}
+
+UEnhancedInputUserSettings* UUINavPCComponent::GetInputUserSettings() const
+{
+	if (!IsValid(PC) || !IsValid(PC->GetLocalPlayer()))
+	{
+		return nullptr;
+	}
+
+	const UEnhancedInputLocalPlayerSubsystem* const InputSubsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PC->GetLocalPlayer());
+	return IsValid(InputSubsystem) ? InputSubsystem->GetUserSettings() : nullptr;
+}
+
+void UUINavPCComponent::InvalidateInputKeyCache()
+{
+	InputKeyCache.Reset();
+	InputKeysCache.Reset();
+	MappableKeyCache.Reset();
+}
+
+static FString GetInputRecordingPath(const FString& FilePath)
+{
+	return FPaths::IsRelative(FilePath) ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("UINavInputRecordings"), FilePath) : FilePath;
+}
+
+void UUINavPCComponent::StartInputRecording()
+{
+	if (!SharedInputProcessor.IsValid())
+	{
+		DISPLAYERROR("StartInputRecording: Input processor isn't registered yet");
+		return;
+	}
+
+	SharedInputProcessor->StartRecording();
+}
+
+bool UUINavPCComponent::StopInputRecording(const FString& FilePath)
+{
+	if (!SharedInputProcessor.IsValid() || !SharedInputProcessor->IsRecording())
+	{
+		return false;
+	}
+
+	if (!SharedInputProcessor->StopRecording(GetInputRecordingPath(FilePath)))
+	{
+		DISPLAYERROR(FString::Printf(TEXT("StopInputRecording: Couldn't save input recording to %s"), *FilePath));
+		return false;
+	}
+	return true;
+}
+
+bool UUINavPCComponent::StartInputReplay(const FString& FilePath, const bool bAtMaxSpeed /*= false*/)
+{
+	if (!SharedInputProcessor.IsValid())
+	{
+		DISPLAYERROR("StartInputReplay: Input processor isn't registered yet");
+		return false;
+	}
+
+	if (!SharedInputProcessor->StartReplay(GetInputRecordingPath(FilePath), bAtMaxSpeed))
+	{
+		DISPLAYERROR(FString::Printf(TEXT("StartInputReplay: %s isn't a valid input recording"), *FilePath));
+		return false;
+	}
+	return true;
+}
+
+void UUINavPCComponent::StopInputReplay()
+{
+	if (SharedInputProcessor.IsValid())
+	{
+		SharedInputProcessor->StopReplay();
+	}
+}
+
+bool UUINavPCComponent::IsRecordingInput() const
+{
+	return SharedInputProcessor.IsValid() && SharedInputProcessor->IsRecording();
+}
+
+bool UUINavPCComponent::IsReplayingInput() const
+{
+	return SharedInputProcessor.IsValid() && SharedInputProcessor->IsReplaying();
+}
+
+void UUINavPCComponent::OpenInputLatencySpans(const FKeyEvent& KeyEvent)
+{
+	const FSlateApplication& SlateApp = FSlateApplication::Get();
+	if (SlateApp.GetNavigationDirectionFromKey(KeyEvent) != EUINavigation::Invalid)
+	{
+		NavigationLatencySpan.Open();
+		NavigationLatencyKey = KeyEvent.GetKey();
+	}
+	else if (SlateApp.GetNavigationActionFromKey(KeyEvent) == EUINavigationAction::Accept || GamepadSelectKeys.Contains(KeyEvent.GetKey()))
+	{
+		SelectLatencySpan.Open();
+	}
+}
+
+void UUINavPCComponent::CloseInputLatencySpan(const EInputLatencyType LatencyType)
+{
+	if (LatencyType == EInputLatencyType::Navigation)
+	{
+		NavigationLatency.CloseSpan(NavigationLatencySpan);
+	}
+	else
+	{
+		SelectLatency.CloseSpan(SelectLatencySpan);
+	}
+}
+
+FInputLatencyStats UUINavPCComponent::GetInputLatencyStats(const EInputLatencyType LatencyType) const
+{
+	return LatencyType == EInputLatencyType::Navigation ? NavigationLatency.GetStats() : SelectLatency.GetStats();
+}
+
+void UUINavPCComponent::ResetInputLatencyStats()
+{
+	NavigationLatency.Reset();
+	SelectLatency.Reset();
+	NavigationLatencySpan.Close();
+	SelectLatencySpan.Close();
+}
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice DumpInputLatencyCommand(
+	TEXT("UINav.DumpInputLatency"),
+	TEXT("Prints the input-to-focus and input-to-select latency percentiles of every UINavPC. Pass 'reset' to clear them afterwards."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		if (World == nullptr)
+		{
+			return;
+		}
+
+		const bool bReset = Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase);
+		for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+		{
+			const APlayerController* const PlayerController = Iterator->Get();
+			UUINavPCComponent* const UINavPC = IsValid(PlayerController) ? PlayerController->FindComponentByClass<UUINavPCComponent>() : nullptr;
+			if (!IsValid(UINavPC))
+			{
+				continue;
+			}
+
+			for (const EInputLatencyType LatencyType : { EInputLatencyType::Navigation, EInputLatencyType::Select })
+			{
+				const FInputLatencyStats Stats = UINavPC->GetInputLatencyStats(LatencyType);
+				Ar.Logf(TEXT("%s %s latency (%d samples): p50 %.2fms / %d frames, p95 %.2fms / %d frames, p99 %.2fms / %d frames"),
+					*PlayerController->GetName(),
+					LatencyType == EInputLatencyType::Navigation ? TEXT("Navigation") : TEXT("Select"),
+					Stats.SampleCount,
+					Stats.P50Milliseconds, Stats.P50Frames,
+					Stats.P95Milliseconds, Stats.P95Frames,
+					Stats.P99Milliseconds, Stats.P99Frames);
+			}
+
+			if (bReset)
+			{
+				UINavPC->ResetInputLatencyStats();
+			}
+		}
+	}));
+
 void UUINavPCComponent::AddInputContextFromUINavWidget(UUINavWidget* UINavWidget, const UUINavWidget* const ParentLimit /*= nullptr*/)
 {
 	UInputMappingContext* CurrentUINavInputContext = GetUINavInputContext(ActiveWidget);
@@ -370,6 +794,7 @@ void UUINavPCComponent::AddInputContext(const UInputMappingContext* const Contex
 	}
 
 	InputSubsystem->AddMappingContext(Context, Priority);
+	InvalidateInputKeyCache();
 }
 
 void UUINavPCComponent::RemoveInputContext(const UInputMappingContext* const Context)
@@ -381,6 +806,7 @@ void UUINavPCComponent::RemoveInputContext(const UInputMappingContext* const Con
 	}
 
 	InputSubsystem->RemoveMappingContext(Context);
+	InvalidateInputKeyCache();
 }
 
 void UUINavPCComponent::OnControllerConnectionChanged(EInputDeviceConnectionState NewConnectionState, FPlatformUserId UserId, FInputDeviceId UserIndex)
@@ -402,66 +828,85 @@ void UUINavPCComponent::BindNavigationInputs()
 		return;
 	}
 
-	InputActionBindingHandles.Reset();
-
-	if (bAllowDirectionalInput)
+	if (bAllowDirectionalInput && DirectionalInputBindingHandles.IsEmpty())
 	{
-		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuUp, ETriggerEvent::Started, this, &UUINavPCComponent::MenuUpStarted).GetHandle());
-		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuUp, ETriggerEvent::Completed, this, &UUINavPCComponent::MenuUpStopped).GetHandle());
-		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuDown, ETriggerEvent::Started, this, &UUINavPCComponent::MenuDownStarted).GetHandle());
-		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuDown, ETriggerEvent::Completed, this, &UUINavPCComponent::MenuDownStopped).GetHandle());
-		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuLeft, ETriggerEvent::Started, this, &UUINavPCComponent::MenuLeftStarted).GetHandle());
-		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuLeft, ETriggerEvent::Completed, this, &UUINavPCComponent::MenuLeftStopped).GetHandle());
-		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuRight, ETriggerEvent::Started, this, &UUINavPCComponent::MenuRightStarted).GetHandle());
-		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuRight, ETriggerEvent::Completed, this, &UUINavPCComponent::MenuRightStopped).GetHandle());
+		DirectionalInputBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuUp, ETriggerEvent::Started, this, &UUINavPCComponent::MenuUpStarted).GetHandle());
+		DirectionalInputBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuUp, ETriggerEvent::Completed, this, &UUINavPCComponent::MenuUpStopped).GetHandle());
+		DirectionalInputBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuDown, ETriggerEvent::Started, this, &UUINavPCComponent::MenuDownStarted).GetHandle());
+		DirectionalInputBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuDown, ETriggerEvent::Completed, this, &UUINavPCComponent::MenuDownStopped).GetHandle());
+		DirectionalInputBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuLeft, ETriggerEvent::Started, this, &UUINavPCComponent::MenuLeftStarted).GetHandle());
+		DirectionalInputBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuLeft, ETriggerEvent::Completed, this, &UUINavPCComponent::MenuLeftStopped).GetHandle());
+		DirectionalInputBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuRight, ETriggerEvent::Started, this, &UUINavPCComponent::MenuRightStarted).GetHandle());
+		DirectionalInputBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuRight, ETriggerEvent::Completed, this, &UUINavPCComponent::MenuRightStopped).GetHandle());
 	}
-	if (bAllowSelectInput)
+	if (bAllowSelectInput && SelectInputBindingHandles.IsEmpty())
 	{
-		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuSelect, ETriggerEvent::Started, this, &UUINavPCComponent::SimulateStartSelect).GetHandle());
-		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuSelect, ETriggerEvent::Completed, this, &UUINavPCComponent::SimulateStopSelect).GetHandle());
-
-		const UInputMappingContext* const UINavContext = GetUINavInputContext(ActiveWidget);
-		if (IsValid(UINavContext))
-		{
-			for (const FEnhancedActionKeyMapping& ActionMapping : UINavContext->GetMappings())
-			{
-				if (ActionMapping.Action == InputActions->IA_MenuSelect &&
-					ActionMapping.Key.IsGamepadKey())
-				{
-					GamepadSelectKeys.AddUnique(ActionMapping.Key);
-				}
-			}
-		}
+		SelectInputBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuSelect, ETriggerEvent::Started, this, &UUINavPCComponent::SimulateStartSelect).GetHandle());
+		SelectInputBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuSelect, ETriggerEvent::Completed, this, &UUINavPCComponent::SimulateStopSelect).GetHandle());
 	}
-	if (bAllowReturnInput)
+	if (bAllowReturnInput && ReturnInputBindingHandles.IsEmpty())
 	{
-		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuReturn, ETriggerEvent::Started, this, &UUINavPCComponent::SimulateStartReturn).GetHandle());
-		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuReturn, ETriggerEvent::Completed, this, &UUINavPCComponent::SimulateStopReturn).GetHandle());
+		ReturnInputBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuReturn, ETriggerEvent::Started, this, &UUINavPCComponent::SimulateStartReturn).GetHandle());
+		ReturnInputBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuReturn, ETriggerEvent::Completed, this, &UUINavPCComponent::SimulateStopReturn).GetHandle());
 	}
-	if (bAllowSectionInput)
+	if (bAllowSectionInput && SectionInputBindingHandles.IsEmpty())
 	{
-		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuNext, ETriggerEvent::Started, this, &UUINavPCComponent::MenuNextStarted).GetHandle());
-		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuPrevious, ETriggerEvent::Started, this, &UUINavPCComponent::MenuPreviousStarted).GetHandle());
-		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuNext, ETriggerEvent::Completed, this, &UUINavPCComponent::MenuNextStopped).GetHandle());
-		InputActionBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuPrevious, ETriggerEvent::Completed, this, &UUINavPCComponent::MenuPreviousStopped).GetHandle());
+		SectionInputBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuNext, ETriggerEvent::Started, this, &UUINavPCComponent::MenuNextStarted).GetHandle());
+		SectionInputBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuPrevious, ETriggerEvent::Started, this, &UUINavPCComponent::MenuPreviousStarted).GetHandle());
+		SectionInputBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuNext, ETriggerEvent::Completed, this, &UUINavPCComponent::MenuNextStopped).GetHandle());
+		SectionInputBindingHandles.Add(InputComponent->BindAction(InputActions->IA_MenuPrevious, ETriggerEvent::Completed, this, &UUINavPCComponent::MenuPreviousStopped).GetHandle());
 	}
+
+	CacheGamepadSelectKeys();
 }
 
 void UUINavPCComponent::UnbindNavigationInputs()
+{
+	UnbindNavigationInputs(DirectionalInputBindingHandles);
+	UnbindNavigationInputs(SelectInputBindingHandles);
+	UnbindNavigationInputs(ReturnInputBindingHandles);
+	UnbindNavigationInputs(SectionInputBindingHandles);
+
+	GamepadSelectKeys.Reset();
+}
+
+void UUINavPCComponent::UnbindNavigationInputs(TArray<int32>& BindingHandles)
 {
 	UEnhancedInputComponent* InputComponent = GetEnhancedInputComponent();
-	if (!IsValid(InputComponent))
+	if (IsValid(InputComponent))
+	{
+		for (const int32 Handle : BindingHandles)
+		{
+			InputComponent->RemoveActionBindingForHandle(Handle);
+		}
+	}
+
+	BindingHandles.Reset();
+}
+
+void UUINavPCComponent::CacheGamepadSelectKeys()
+{
+	GamepadSelectKeys.Reset();
+	if (!bAllowSelectInput)
 	{
 		return;
 	}
 
-	for (const int32 Handle : InputActionBindingHandles)
+	const UUINavEnhancedInputActions* const InputActions = GetDefault<UUINavSettings>()->EnhancedInputActions.LoadSynchronous();
+	const UInputMappingContext* const UINavContext = GetUINavInputContext(ActiveWidget);
+	if (InputActions == nullptr || !IsValid(UINavContext))
 	{
-		InputComponent->RemoveActionBindingForHandle(Handle);
+		return;
 	}
 
-	InputActionBindingHandles.Reset();
-	GamepadSelectKeys.Reset();
+	for (const FEnhancedActionKeyMapping& ActionMapping : UINavContext->GetMappings())
+	{
+		if (ActionMapping.Action == InputActions->IA_MenuSelect &&
+			ActionMapping.Key.IsGamepadKey())
+		{
+			GamepadSelectKeys.AddUnique(ActionMapping.Key);
+		}
+	}
 }
 
 void UUINavPCComponent::MenuUpStarted()
@@ -569,47 +1014,54 @@ UUINavWidget* UUINavPCComponent::GetFirstCommonParent(UUINavWidget* const Widget
 		return nullptr;
 	}
 
-	UUINavWidget* CommonParent = Widget1->GetMostOuterUINavWidget();
-	if (CommonParent == nullptr)
+	// A root widget isn't considered its own common parent
+	if (Widget1 == Widget2 && Widget1->GetPathDepth() == 0)
 	{
 		return nullptr;
 	}
 
-	uint8 Depth = 0;
-	const TArray<int> OldPath = Widget1 != nullptr ? Widget1->GetUINavWidgetPath() : TArray<int>();
-	const TArray<int> NewPath = Widget2 != nullptr ? Widget2->GetUINavWidgetPath() : TArray<int>();
-	while (true)
+	UUINavWidget* CommonParent = Widget1->GetPathDepth() >= Widget2->GetPathDepth() ? Widget1 : Widget2;
+	const UUINavWidget* const OtherWidget = CommonParent == Widget1 ? Widget2 : Widget1;
+	while (CommonParent != nullptr && !OtherWidget->IsDescendantOf(CommonParent))
 	{
-		const int OldIndex = OldPath.Num() > Depth ? OldPath[Depth] : -1;
-		const int NewIndex = NewPath.Num() > Depth ? NewPath[Depth] : -1;
+		CommonParent = CommonParent->GetPathParent();
+	}
 
-		if (OldIndex == -1 && NewIndex == -1)
-		{
-			break;
-		}
+	return CommonParent;
+}
 
-		Depth++;
+void UUINavPCComponent::CacheGameInputContexts()
+{
+	UINAV_SCOPE_CYCLE_COUNTER(STAT_UINavCacheGameInputContexts);
 
-		if (OldIndex == NewIndex)
-		{
-			CommonParent = CommonParent->GetChildUINavWidget(OldIndex);
-		}
-		else
+	if (bGameInputContextsReady || GameInputContextsHandle.IsValid())
+	{
+		return;
+	}
+
+	const UUINavSettings* const UINavSettings = GetDefault<UUINavSettings>();
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UInputMappingContext::StaticClass()->GetClassPathName());
+	for (const FDirectoryPath& ContextPath : UINavSettings->GameInputContextPaths)
+	{
+		if (!ContextPath.Path.IsEmpty())
 		{
-			break;
+			Filter.PackagePaths.Add(FName(ContextPath.Path));
 		}
 	}
+	Filter.bRecursivePaths = true;
+	for (const FName& ContextTag : UINavSettings->GameInputContextTags)
+	{
+		Filter.TagsAndValues.Add(ContextTag);
+	}
 
-	return Depth > 0 ? CommonParent : nullptr;
-}
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	TArray<FAssetData> AssetsData;
+	AssetRegistryModule.Get().GetAssets(Filter, AssetsData);
 
-void UUINavPCComponent::CacheGameInputContexts()
-{
-	if (CachedInputContexts.Num() == 0)
+	if (!UINavSettings->bLoadGameInputContextsAsync)
 	{
-		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
-		TArray<FAssetData> AssetsData;
-		AssetRegistryModule.Get().GetAssetsByClass(UInputMappingContext::StaticClass()->GetClassPathName(), AssetsData);
 		for (const FAssetData& AssetData : AssetsData)
 		{
 			const UInputMappingContext* const InputContext = Cast<UInputMappingContext>(AssetData.GetAsset());
@@ -618,9 +1070,54 @@ void UUINavPCComponent::CacheGameInputContexts()
 				continue;
 			}
 
-			CachedInputContexts.Add(InputContext);
+			CachedInputContexts.Add(InputContext);
+		}
+
+		bGameInputContextsReady = true;
+		GameInputContextsReadyDelegate.Broadcast();
+		return;
+	}
+
+	TArray<FSoftObjectPath> ContextPaths;
+	ContextPaths.Reserve(AssetsData.Num());
+	for (const FAssetData& AssetData : AssetsData)
+	{
+		ContextPaths.Add(AssetData.GetSoftObjectPath());
+	}
+
+	if (ContextPaths.IsEmpty())
+	{
+		OnGameInputContextsLoaded(ContextPaths);
+		return;
+	}
+
+	GameInputContextsHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		ContextPaths,
+		FStreamableDelegate::CreateUObject(this, &UUINavPCComponent::OnGameInputContextsLoaded, ContextPaths));
+}
+
+void UUINavPCComponent::OnGameInputContextsLoaded(TArray<FSoftObjectPath> ContextPaths)
+{
+	for (const FSoftObjectPath& ContextPath : ContextPaths)
+	{
+		const UInputMappingContext* const InputContext = Cast<UInputMappingContext>(ContextPath.ResolveObject());
+		if (!IsValid(InputContext))
+		{
+			continue;
 		}
+
+		CachedInputContexts.AddUnique(InputContext);
 	}
+
+	GameInputContextsHandle.Reset();
+	bGameInputContextsReady = true;
+	InvalidateInputKeyCache();
+
+	GameInputContextsReadyDelegate.Broadcast();
+
+	//Input displays may have fallen back to a different key while the contexts were loading
+	ForceUpdateAllInputDisplays();
+	UpdateInputIconsDelegate.Broadcast();
 }
 
 void UUINavPCComponent::InitPlatformData()
@@ -636,6 +1133,8 @@ void UUINavPCComponent::InitPlatformData()
 		CurrentPlatformData.GamepadKeyNameData = GamepadKeyNameData;
 		CurrentPlatformData.bCanUseKeyboardMouse = true;
 	}
+
+	MarkKeyDataDirty();
 }
 
 void UUINavPCComponent::ProcessRebind(const FKeyEvent& KeyEvent)
@@ -701,6 +1200,7 @@ void UUINavPCComponent::SetActiveWidget(UUINavWidget * NewActiveWidget)
 
 	ActiveWidget = NewActiveWidget;
 	ActiveSubWidget = nullptr;
+	bUsingThumbstickAsMouse = UsingThumbstickAsMouse() != EThumbstickAsMouse::None;
 	RefreshNavigationKeys();
 
 	const UUINavWidget* const CommonParent = GetFirstCommonParent(ActiveWidget, OldActiveWidget);
@@ -749,9 +1249,10 @@ void UUINavPCComponent::NotifyNavigatedTo(UUINavWidget* NavigatedWidget)
 	UUINavWidget* CommonParent = OldActiveWidget != nullptr && OldActiveWidget->GetMostOuterUINavWidget() == NavigatedWidget->GetMostOuterUINavWidget() ? OldActiveWidget->GetMostOuterUINavWidget() : nullptr;
 	ActiveSubWidget = CommonParent != NavigatedWidget ? NavigatedWidget : nullptr;
 
+	static const TArray<int> EmptyPath;
 	uint8 Depth = 0;
-	const TArray<int>& OldPath = OldActiveWidget != nullptr ? OldActiveWidget->GetUINavWidgetPath() : TArray<int>();
-	const TArray<int>& NewPath = NavigatedWidget != nullptr ? NavigatedWidget->GetUINavWidgetPath() : TArray<int>();
+	const TArray<int>& OldPath = OldActiveWidget != nullptr ? OldActiveWidget->GetUINavWidgetPath() : EmptyPath;
+	const TArray<int>& NewPath = NavigatedWidget != nullptr ? NavigatedWidget->GetUINavWidgetPath() : EmptyPath;
 
 	if (OldPath.IsEmpty() && OldActiveWidget != nullptr) OldActiveWidget->LoseNavigation(NavigatedWidget);
 
@@ -802,13 +1303,15 @@ void UUINavPCComponent::NotifyNavigatedTo(UUINavWidget* NavigatedWidget)
 
 UUINavWidget* UUINavPCComponent::GoToWidget(TSubclassOf<UUINavWidget> NewWidgetClass, const bool bRemoveParent, const bool bDestroyParent, const int ZOrder)
 {
+	UINAV_SCOPE_CYCLE_COUNTER(STAT_UINavGoToWidget);
+
 	if (NewWidgetClass == nullptr)
 	{
 		DISPLAYERROR("GoToWidget: No Widget Class found");
 		return nullptr;
 	}
 
-	UUINavWidget* NewWidget = CreateWidget<UUINavWidget>(PC, NewWidgetClass);
+	UUINavWidget* NewWidget = AcquirePooledWidget(NewWidgetClass);
 	return GoToBuiltWidget(NewWidget, bRemoveParent, bDestroyParent, ZOrder);
 }
 
@@ -827,6 +1330,7 @@ UUINavWidget* UUINavPCComponent::GoToPromptWidget(TSubclassOf<UUINavPromptWidget
 	}
 
 	UUINavPromptWidget* NewWidget = CreateWidget<UUINavPromptWidget>(PC, NewWidgetClass);
+	INC_DWORD_STAT(STAT_UINavWidgetsCreated);
 	NewWidget->Title = Title;
 	NewWidget->Message = Message;
 	NewWidget->SetCallback(Event);
@@ -847,12 +1351,64 @@ UUINavWidget* UUINavPCComponent::GoToBuiltWidget(UUINavWidget* NewWidget, const
 	return ActiveWidget->GoToBuiltWidget(NewWidget, bRemoveParent, bDestroyParent, ZOrder);
 }
 
+UUINavWidget* UUINavPCComponent::AcquirePooledWidget(TSubclassOf<UUINavWidget> WidgetClass)
+{
+	if (WidgetClass == nullptr) return nullptr;
+
+	FUINavWidgetPool* Pool = WidgetPools.Find(WidgetClass);
+	if (Pool != nullptr)
+	{
+		while (!Pool->Widgets.IsEmpty())
+		{
+			UUINavWidget* PooledWidget = Pool->Widgets.Pop(EAllowShrinking::No);
+			if (IsValid(PooledWidget) && !PooledWidget->IsInViewport())
+			{
+				return PooledWidget;
+			}
+		}
+	}
+
+	UUINavWidget* NewWidget = CreateWidget<UUINavWidget>(PC, WidgetClass);
+	INC_DWORD_STAT(STAT_UINavWidgetsCreated);
+	if (NewWidget != nullptr)
+	{
+		NewWidget->bAcquiredFromPool = GetDefault<UUINavSettings>()->WidgetPoolCapacity > 0;
+	}
+	return NewWidget;
+}
+
+bool UUINavPCComponent::ReleasePooledWidget(UUINavWidget* Widget)
+{
+	if (!IsValid(Widget) || !Widget->bAcquiredFromPool || Widget->IsInViewport()) return false;
+
+	const int32 PoolCapacity = GetDefault<UUINavSettings>()->WidgetPoolCapacity;
+	if (PoolCapacity <= 0) return false;
+
+	FUINavWidgetPool& Pool = WidgetPools.FindOrAdd(Widget->GetClass());
+	if (Pool.Widgets.Num() >= PoolCapacity || Pool.Widgets.Contains(Widget)) return false;
+
+	Widget->ResetForPool();
+	Pool.Widgets.Add(Widget);
+	return true;
+}
+
+void UUINavPCComponent::ClearWidgetPool()
+{
+	WidgetPools.Empty();
+}
+
 EThumbstickAsMouse UUINavPCComponent::UsingThumbstickAsMouse() const
 {
 	const EThumbstickAsMouse ActiveWidgetThumbstickAsMouse = IsValid(ActiveWidget) ? ActiveWidget->GetUseThumbstickAsMouse() : EThumbstickAsMouse::None;
 	return ActiveWidgetThumbstickAsMouse != EThumbstickAsMouse::None ? ActiveWidgetThumbstickAsMouse : UseThumbstickAsMouse;
 }
 
+void UUINavPCComponent::SetUseThumbstickAsMouse(const EThumbstickAsMouse NewUseThumbstickAsMouse)
+{
+	UseThumbstickAsMouse = NewUseThumbstickAsMouse;
+	UpdateUsingThumbstickAsMouse();
+}
+
 void UUINavPCComponent::SetShowMouseCursor(const bool bShowMouse)
 {
 	if (!IsValid(PC))
@@ -897,30 +1453,91 @@ bool UUINavPCComponent::ShouldHideMouseCursor() const
 
 void UUINavPCComponent::RefreshNavigationKeys()
 {
-	FSlateApplication::Get().SetNavigationConfig(
-		MakeShared<FUINavigationConfig>(
+	UINAV_SCOPE_CYCLE_COUNTER(STAT_UINavRefreshNavigationKeys);
+
+	const bool bUseAnalogNavigation = bUseAnalogDirectionalInput && UsingThumbstickAsMouse() != EThumbstickAsMouse::LeftThumbstick;
+	const bool bThumbstickAsMouse = UsingThumbstickAsMouse() != EThumbstickAsMouse::None;
+
+	FSlateApplication& SlateApplication = FSlateApplication::Get();
+	if (NavigationConfig.IsValid() && &SlateApplication.GetNavigationConfig().Get() == NavigationConfig.Get())
+	{
+		NavigationConfig->Refresh(
+			this,
+			bAllowDirectionalInput,
+			bAllowSectionInput,
+			bAllowSelectInput,
+			bAllowReturnInput,
+			bUseAnalogNavigation,
+			bThumbstickAsMouse);
+
+		INC_DWORD_STAT(STAT_UINavNavigationConfigIncrementalRefreshes);
+	}
+	else
+	{
+		NavigationConfig = MakeShared<FUINavigationConfig>(
 			this,
 			bAllowDirectionalInput,
 			bAllowSectionInput,
 			bAllowSelectInput,
 			bAllowReturnInput,
-			bUseAnalogDirectionalInput && UsingThumbstickAsMouse() != EThumbstickAsMouse::LeftThumbstick,
-			UsingThumbstickAsMouse() != EThumbstickAsMouse::None));
+			bUseAnalogNavigation,
+			bThumbstickAsMouse);
+		SlateApplication.SetNavigationConfig(NavigationConfig.ToSharedRef());
+
+		INC_DWORD_STAT(STAT_UINavNavigationConfigFullRebuilds);
+	}
 
 	if (IsValid(ActiveWidget))
 	{
 		if (!GetDefault<UUINavSettings>()->bUseFocusSystemNavigationInputs)
 		{
-			UnbindNavigationInputs();
+			//Only unbind the inputs that are no longer allowed, BindNavigationInputs skips the ones that are still bound
+			if (!bAllowDirectionalInput) UnbindNavigationInputs(DirectionalInputBindingHandles);
+			if (!bAllowSelectInput) UnbindNavigationInputs(SelectInputBindingHandles);
+			if (!bAllowReturnInput) UnbindNavigationInputs(ReturnInputBindingHandles);
+			if (!bAllowSectionInput) UnbindNavigationInputs(SectionInputBindingHandles);
 			BindNavigationInputs();
 		}
 		else
 		{
-			GamepadSelectKeys = StaticCastSharedRef<FUINavigationConfig>(FSlateApplication::Get().GetNavigationConfig())->GetGamepadSelectKeys();
+			GamepadSelectKeys = NavigationConfig->GetGamepadSelectKeys();
 		}
 	}
 }
 
+void UUINavPCComponent::ApplyNavigationKeyRebind(const FName PlayerMappableKeySettingsName, const FKey& OldKey, const FKey& NewKey)
+{
+	const UInputMappingContext* const UINavContext = GetUINavInputContext(ActiveWidget);
+	if (!IsValid(UINavContext))
+	{
+		return;
+	}
+
+	const bool bIsNavigationMapping = UINavContext->GetMappings().ContainsByPredicate([PlayerMappableKeySettingsName](const FEnhancedActionKeyMapping& Mapping)
+	{
+		const UPlayerMappableKeySettings* const KeySettings = Mapping.GetPlayerMappableKeySettings();
+		return IsValid(KeySettings) && KeySettings->Name == PlayerMappableKeySettingsName;
+	});
+
+	if (!bIsNavigationMapping)
+	{
+		return;
+	}
+
+	if (!NavigationConfig.IsValid() ||
+		&FSlateApplication::Get().GetNavigationConfig().Get() != NavigationConfig.Get() ||
+		!NavigationConfig->RebindKey(this, PlayerMappableKeySettingsName, OldKey, NewKey))
+	{
+		RefreshNavigationKeys();
+		return;
+	}
+
+	if (GetDefault<UUINavSettings>()->bUseFocusSystemNavigationInputs)
+	{
+		GamepadSelectKeys = NavigationConfig->GetGamepadSelectKeys();
+	}
+}
+
 void UUINavPCComponent::SetAllowAllMenuInput(const bool bAllowInput)
 {
 	bAllowDirectionalInput = bAllowInput;
@@ -959,6 +1576,7 @@ void UUINavPCComponent::SetGamepadInputDataTables(UDataTable* NewKeyIconTable, U
 {
 	CurrentPlatformData.GamepadKeyIconData = NewKeyIconTable;
 	CurrentPlatformData.GamepadKeyNameData = NewKeyNameTable;
+	MarkKeyDataDirty();
 
 	if (bUpdateInputDisplays && CurrentInputType == EInputType::Gamepad)
 	{
@@ -970,6 +1588,7 @@ void UUINavPCComponent::SetKeyboardInputDataTables(UDataTable* NewKeyIconTable,
 {
 	KeyboardMouseKeyIconData = NewKeyIconTable;
 	KeyboardMouseKeyNameData = NewKeyNameTable;
+	MarkKeyDataDirty();
 
 	if (bUpdateInputDisplays && CurrentInputType != EInputType::Gamepad)
 	{
@@ -987,17 +1606,77 @@ void UUINavPCComponent::InputKey(const FKey& Key, const EInputEvent Event, const
 
 void UUINavPCComponent::ForceUpdateAllInputDisplays(const bool bOnlyTopLevel /*= false*/)
 {
-	TArray<UUserWidget*> Widgets;
-	UWidgetBlueprintLibrary::GetAllWidgetsOfClass(this, Widgets, UUINavInputDisplay::StaticClass(), /*bTopLevel*/ bOnlyTopLevel);
-	for (UUserWidget* Widget : Widgets)
+	for (const TWeakObjectPtr<UUINavInputDisplay>& InputDisplay : InputDisplays)
+	{
+		if (InputDisplay.IsValid() && (!bOnlyTopLevel || InputDisplay->IsInViewport()))
+		{
+			MarkInputDisplayDirty(InputDisplay.Get());
+		}
+	}
+}
+
+void UUINavPCComponent::RegisterInputDisplay(UUINavInputDisplay* InputDisplay)
+{
+	InputDisplays.AddUnique(InputDisplay);
+}
+
+void UUINavPCComponent::UnregisterInputDisplay(UUINavInputDisplay* InputDisplay)
+{
+	InputDisplays.RemoveSingleSwap(InputDisplay, EAllowShrinking::No);
+	InputDisplay->bVisualsDirty = false;
+}
+
+void UUINavPCComponent::MarkInputDisplayDirty(UUINavInputDisplay* InputDisplay)
+{
+	if (!IsValid(InputDisplay) || InputDisplay->bVisualsDirty)
+	{
+		return;
+	}
+
+	InputDisplay->bVisualsDirty = true;
+	DirtyInputDisplays.Add(InputDisplay);
+	RequestTick();
+}
+
+void UUINavPCComponent::UpdateDirtyInputDisplays()
+{
+	if (DirtyInputDisplays.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<TWeakObjectPtr<UUINavInputDisplay>> PendingDisplays = MoveTemp(DirtyInputDisplays);
+	DirtyInputDisplays.Reset();
+
+	// Displays on screen are updated first, so the ones left for the next frames aren't visible
+	int32 NumOnScreen = 0;
+	for (int32 i = 0; i < PendingDisplays.Num(); ++i)
+	{
+		if (PendingDisplays[i].IsValid() && PendingDisplays[i]->IsOnScreen())
+		{
+			PendingDisplays.Swap(i, NumOnScreen++);
+		}
+	}
+
+	const double Budget = GetDefault<UUINavSettings>()->InputDisplayUpdateBudget / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+	int32 NumUpdated = 0;
+	for (int32 i = 0; i < PendingDisplays.Num(); ++i)
 	{
-		UUINavInputDisplay* InputDisplay = Cast<UUINavInputDisplay>(Widget);
-		if (!IsValid(InputDisplay))
+		UUINavInputDisplay* const InputDisplay = PendingDisplays[i].Get();
+		if (!IsValid(InputDisplay) || !InputDisplay->bVisualsDirty)
 		{
 			continue;
 		}
 
+		if (Budget > 0.0 && NumUpdated > 0 && FPlatformTime::Seconds() - StartTime >= Budget)
+		{
+			DirtyInputDisplays.Append(PendingDisplays.GetData() + i, PendingDisplays.Num() - i);
+			break;
+		}
+
 		InputDisplay->UpdateInputVisuals();
+		++NumUpdated;
 	}
 }
 
@@ -1009,6 +1688,7 @@ void UUINavPCComponent::HandleKeyDownEvent(FSlateApplication& SlateApp, const FK
 
 	LastPressedKey = InKeyEvent.GetKey();
 	LastPressedKeyUserIndex = InKeyEvent.GetUserIndex();
+	OpenInputLatencySpans(InKeyEvent);
 	VerifyInputTypeChangeByKey(InKeyEvent, bShouldUnforceNavigation);
 
 	if (!bShouldUnforceNavigation && IsValid(ActiveWidget))
@@ -1027,6 +1707,12 @@ void UUINavPCComponent::HandleKeyUpEvent(FSlateApplication& SlateApp, const FKey
 	LastReleasedKey = InKeyEvent.GetKey();
 	LastReleasedKeyUserIndex = InKeyEvent.GetUserIndex();
 
+	// A navigation key that didn't cause a focus change by the time it's released never will
+	if (InKeyEvent.GetKey() == NavigationLatencyKey)
+	{
+		NavigationLatencySpan.Close();
+	}
+
 	if (IsValid(ListeningInputBox)) return;
 
 	if (!bShouldUnforceNavigation)
@@ -1048,6 +1734,9 @@ void UUINavPCComponent::HandleAnalogInputEvent(FSlateApplication& SlateApp, cons
 		NotifyInputTypeChange(EInputType::Gamepad);
 	}
 
+	// The thumbstick cursor mode may have been changed while this component wasn't ticking
+	UpdateUsingThumbstickAsMouse();
+
 	TSharedRef<FUINavigationConfig> UINavConfig = StaticCastSharedRef<FUINavigationConfig>(FSlateApplication::Get().GetNavigationConfig());
 	FKey UsedAnalogKey;
 	if (InAnalogInputEvent.GetKey() == EKeys::Gamepad_LeftX)
@@ -1101,6 +1790,7 @@ void UUINavPCComponent::HandleAnalogInputEvent(FSlateApplication& SlateApp, cons
 			RefreshNavigationKeys();
 		}
 		bReceivedAnalogInput = true;
+		RequestTick();
 	}
 
 	if (bScrollWithRightThumbstick &&
@@ -1154,6 +1844,12 @@ void UUINavPCComponent::HandleMouseMoveEvent(FSlateApplication& SlateApp, const
 
 void UUINavPCComponent::HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
 {
+	if (!bIgnoreMousePress)
+	{
+		// Selects caused by mouse clicks aren't measured
+		SelectLatencySpan.Close();
+	}
+
 	if (CurrentInputType != EInputType::Mouse)
 	{
 		if (bIgnoreMousePress && MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton)
@@ -1261,6 +1957,7 @@ void UUINavPCComponent::SetTimer(const EUINavigation TimerDirection)
 	TimerCounter = 0.f;
 	CallbackDirection = TimerDirection;
 	CountdownPhase = ECountdownPhase::First;
+	RequestTick();
 }
 
 void UUINavPCComponent::ClearNavigationTimer()
@@ -1279,25 +1976,7 @@ bool UUINavPCComponent::IsWidgetActive(const UUINavWidget* const UINavWidget) co
 		return false;
 	}
 
-	if (ActiveWidget == UINavWidget)
-	{
-		return true;
-	}
-
-	for (const UUINavWidget* const ChildUINavWidget : UINavWidget->ChildUINavWidgets)
-	{
-		if (!IsValid(ChildUINavWidget))
-		{
-			continue;
-		}
-
-		if (IsWidgetActive(ChildUINavWidget))
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return ActiveWidget->IsDescendantOf(UINavWidget);
 }
 
 bool UUINavPCComponent::IsWidgetChild(const UUINavWidget* const ParentWidget, const UUINavWidget* const ChildWidget) const
@@ -1307,24 +1986,30 @@ bool UUINavPCComponent::IsWidgetChild(const UUINavWidget* const ParentWidget, co
 		return false;
 	}
 
-	for (const UUINavWidget* const ChildUINavWidget : ParentWidget->ChildUINavWidgets)
+	return ChildWidget->IsDescendantOf(ParentWidget, false);
+}
+
+FKey UUINavPCComponent::GetEnhancedInputKey(const UInputAction* Action, const EInputAxis Axis, const EAxisType Scale, const EInputRestriction InputRestriction) const
+{
+	UINAV_SCOPE_CYCLE_COUNTER(STAT_UINavGetEnhancedInputKey);
+
+	if (!IsValid(Action))
 	{
-		if (!IsValid(ChildUINavWidget))
-		{
-			continue;
-		}
+		return FKey();
+	}
 
-		if (ChildUINavWidget == ChildWidget ||
-			IsWidgetChild(ChildUINavWidget, ChildWidget))
-		{
-			return true;
-		}
+	const FUINavInputKeyQuery Query(Action, Axis, Scale, InputRestriction);
+	if (const FKey* const CachedKey = InputKeyCache.Find(Query))
+	{
+		return *CachedKey;
 	}
 
-	return false;
+	const FKey Key = FindEnhancedInputKey(Action, Axis, Scale, InputRestriction);
+	InputKeyCache.Add(Query, Key);
+	return Key;
 }
 
-FKey UUINavPCComponent::GetEnhancedInputKey(const UInputAction* Action, const EInputAxis Axis, const EAxisType Scale, const EInputRestriction InputRestriction) const
+FKey UUINavPCComponent::FindEnhancedInputKey(const UInputAction* Action, const EInputAxis Axis, const EAxisType Scale, const EInputRestriction InputRestriction) const
 {
 	if (UUINavBlueprintFunctionLibrary::IsUINavInputAction(Action))
 	{
@@ -1400,6 +2085,18 @@ FKey UUINavPCComponent::GetEnhancedInputKey(const UInputAction* Action, const EI
 }
 
 FKey UUINavPCComponent::GetEnhancedInputMappableKey(FName PlayerMappableKeySettingsName) const
+{
+	if (const FKey* const CachedKey = MappableKeyCache.Find(PlayerMappableKeySettingsName))
+	{
+		return *CachedKey;
+	}
+
+	const FKey Key = FindEnhancedInputMappableKey(PlayerMappableKeySettingsName);
+	MappableKeyCache.Add(PlayerMappableKeySettingsName, Key);
+	return Key;
+}
+
+FKey UUINavPCComponent::FindEnhancedInputMappableKey(const FName PlayerMappableKeySettingsName) const
 {
 	UEnhancedInputLocalPlayerSubsystem* PlayerSubsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(GetPC()->GetLocalPlayer());
 	if (!IsValid(PlayerSubsystem))
@@ -1422,7 +2119,13 @@ FKey UUINavPCComponent::GetEnhancedInputMappableKey(FName PlayerMappableKeySetti
 UTexture2D* UUINavPCComponent::GetKeyIcon(const FKey Key) const
 {
 	TSoftObjectPtr<UTexture2D> SoftKeyIcon = GetSoftKeyIcon(Key);
-	return SoftKeyIcon.IsNull() ? nullptr : SoftKeyIcon.LoadSynchronous();
+	if (SoftKeyIcon.IsNull())
+	{
+		return nullptr;
+	}
+
+	INC_DWORD_STAT(STAT_UINavInputIconsLoadedSynchronously);
+	return SoftKeyIcon.LoadSynchronous();
 }
 
 TSoftObjectPtr<UTexture2D> UUINavPCComponent::GetSoftKeyIcon(const FKey Key) const
@@ -1432,22 +2135,186 @@ TSoftObjectPtr<UTexture2D> UUINavPCComponent::GetSoftKeyIcon(const FKey Key) con
 
 FInputIconMapping UUINavPCComponent::GetKeyIconMapping(const FKey Key) const
 {
-	FInputIconMapping* KeyIcon = nullptr;
-	if (Key.IsGamepadKey())
+	if (bKeyDataDirty)
+	{
+		RebuildKeyData();
+	}
+
+	const FInputIconMapping* const KeyIcon = KeyIconMappings.Find(Key);
+	return KeyIcon != nullptr ? *KeyIcon : FInputIconMapping();
+}
+
+UTexture2D* UUINavPCComponent::RequestKeyIcon(const FKey Key, const bool bHighPriority, const FSimpleDelegate& OnLoaded /*= FSimpleDelegate()*/)
+{
+	return Cast<UTexture2D>(RequestKeyIconAsset(GetKeyIconMapping(Key).InputIcon.ToSoftObjectPath(), bHighPriority, OnLoaded));
+}
+
+UFont* UUINavPCComponent::RequestKeyIconFont(const FKey Key, const bool bHighPriority, const FSimpleDelegate& OnLoaded /*= FSimpleDelegate()*/)
+{
+	return Cast<UFont>(RequestKeyIconAsset(GetKeyIconMapping(Key).InputIconFont.ToSoftObjectPath(), bHighPriority, OnLoaded));
+}
+
+void UUINavPCComponent::ClearResidentKeyIcons()
+{
+	ResidentKeyIconAssets.Empty();
+	ResidentKeyIconAssetSizes.Empty();
+	ResidentKeyIconBytes = 0;
+	FailedKeyIconAssets.Empty();
+}
+
+UObject* UUINavPCComponent::RequestKeyIconAsset(const FSoftObjectPath& AssetPath, const bool bHighPriority, const FSimpleDelegate& OnLoaded)
+{
+	if (AssetPath.IsNull() || FailedKeyIconAssets.Contains(AssetPath))
+	{
+		return nullptr;
+	}
+
+	if (UObject* const Asset = AssetPath.ResolveObject())
+	{
+		MakeKeyIconAssetResident(Asset);
+		return Asset;
+	}
+
+	if (FUINavKeyIconLoad* const PendingLoad = PendingKeyIconLoads.Find(AssetPath))
 	{
-		if (CurrentPlatformData.GamepadKeyIconData != nullptr && CurrentPlatformData.GamepadKeyIconData->GetRowMap().Contains(Key.GetFName()))
+		if (OnLoaded.IsBound())
 		{
-			KeyIcon = reinterpret_cast<FInputIconMapping*>(CurrentPlatformData.GamepadKeyIconData->GetRowMap()[Key.GetFName()]);
+			PendingLoad->OnLoadedCallbacks.Add(OnLoaded);
 		}
+		return nullptr;
+	}
+
+	FUINavKeyIconLoad& NewLoad = PendingKeyIconLoads.Add(AssetPath);
+	if (OnLoaded.IsBound())
+	{
+		NewLoad.OnLoadedCallbacks.Add(OnLoaded);
+	}
+
+	// The load might complete right away, so only store the handle if it's still pending
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		AssetPath,
+		FStreamableDelegate::CreateUObject(this, &UUINavPCComponent::OnKeyIconAssetLoaded, AssetPath),
+		bHighPriority ? FStreamableManager::AsyncLoadHighPriority : FStreamableManager::DefaultAsyncLoadPriority);
+
+	if (FUINavKeyIconLoad* const PendingLoad = PendingKeyIconLoads.Find(AssetPath))
+	{
+		PendingLoad->Handle = Handle;
+	}
+
+	return nullptr;
+}
+
+void UUINavPCComponent::OnKeyIconAssetLoaded(FSoftObjectPath AssetPath)
+{
+	FUINavKeyIconLoad CompletedLoad;
+	if (!PendingKeyIconLoads.RemoveAndCopyValue(AssetPath, CompletedLoad))
+	{
+		return;
+	}
+
+	if (UObject* const Asset = AssetPath.ResolveObject())
+	{
+		MakeKeyIconAssetResident(Asset);
 	}
 	else
 	{
-		if (CurrentPlatformData.bCanUseKeyboardMouse && KeyboardMouseKeyIconData != nullptr && KeyboardMouseKeyIconData->GetRowMap().Contains(Key.GetFName()))
+		FailedKeyIconAssets.Add(AssetPath);
+	}
+
+	for (const FSimpleDelegate& Callback : CompletedLoad.OnLoadedCallbacks)
+	{
+		Callback.ExecuteIfBound();
+	}
+}
+
+void UUINavPCComponent::MakeKeyIconAssetResident(UObject* Asset)
+{
+	int64 AssetSize = INDEX_NONE;
+	const int32 ResidentIndex = ResidentKeyIconAssets.Find(Asset);
+	if (ResidentIndex != INDEX_NONE)
+	{
+		AssetSize = ResidentKeyIconAssetSizes[ResidentIndex];
+		ResidentKeyIconBytes -= AssetSize;
+		ResidentKeyIconAssets.RemoveAt(ResidentIndex, EAllowShrinking::No);
+		ResidentKeyIconAssetSizes.RemoveAt(ResidentIndex, EAllowShrinking::No);
+	}
+
+	const int64 BudgetBytes = static_cast<int64>(GetDefault<UUINavSettings>()->ResidentInputIconsBudgetKB) * 1024;
+	if (BudgetBytes <= 0)
+	{
+		return;
+	}
+
+	if (AssetSize == INDEX_NONE)
+	{
+		AssetSize = static_cast<int64>(Asset->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal));
+	}
+
+	ResidentKeyIconAssets.Add(Asset);
+	ResidentKeyIconAssetSizes.Add(AssetSize);
+	ResidentKeyIconBytes += AssetSize;
+
+	int32 NumEvicted = 0;
+	while (ResidentKeyIconBytes > BudgetBytes && NumEvicted < ResidentKeyIconAssets.Num() - 1)
+	{
+		ResidentKeyIconBytes -= ResidentKeyIconAssetSizes[NumEvicted];
+		++NumEvicted;
+	}
+
+	if (NumEvicted > 0)
+	{
+		ResidentKeyIconAssets.RemoveAt(0, NumEvicted, EAllowShrinking::No);
+		ResidentKeyIconAssetSizes.RemoveAt(0, NumEvicted, EAllowShrinking::No);
+	}
+}
+
+void UUINavPCComponent::MarkKeyDataDirty()
+{
+	bKeyDataDirty = true;
+	FailedKeyIconAssets.Empty();
+}
+
+void UUINavPCComponent::RebuildKeyData() const
+{
+	bKeyDataDirty = false;
+	KeyIconMappings.Reset();
+	KeyNames.Reset();
+
+	// Gamepad keys are only read from the gamepad tables, and every other key from the keyboard and mouse tables
+	const auto AddIconRows = [this](const UDataTable* const Table, const bool bGamepadTable)
+	{
+		if (Table == nullptr) return;
+		for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+		{
+			const FKey Key(Row.Key);
+			if (Key.IsGamepadKey() == bGamepadTable)
+			{
+				KeyIconMappings.Add(Key, *reinterpret_cast<const FInputIconMapping*>(Row.Value));
+			}
+		}
+	};
+
+	const auto AddNameRows = [this](const UDataTable* const Table, const bool bGamepadTable)
+	{
+		if (Table == nullptr) return;
+		for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
 		{
-			KeyIcon = reinterpret_cast<FInputIconMapping*>(KeyboardMouseKeyIconData->GetRowMap()[Key.GetFName()]);
+			const FKey Key(Row.Key);
+			if (Key.IsGamepadKey() == bGamepadTable)
+			{
+				KeyNames.Add(Key, reinterpret_cast<const FInputNameMapping*>(Row.Value)->InputText);
+			}
 		}
+	};
+
+	AddIconRows(CurrentPlatformData.GamepadKeyIconData, true);
+	AddNameRows(CurrentPlatformData.GamepadKeyNameData, true);
+
+	if (CurrentPlatformData.bCanUseKeyboardMouse)
+	{
+		AddIconRows(KeyboardMouseKeyIconData, false);
+		AddNameRows(KeyboardMouseKeyNameData, false);
 	}
-	return KeyIcon != nullptr ? *KeyIcon : FInputIconMapping();
 }
 
 UTexture2D* UUINavPCComponent::GetEnhancedInputIcon(const UInputAction* Action, const EInputAxis Axis, const EAxisType Scale, const EInputRestriction InputRestriction) const
@@ -1469,27 +2336,35 @@ FText UUINavPCComponent::GetKeyText(const FKey Key) const
 {
 	if (!Key.IsValid()) return FText();
 
-	FInputNameMapping* Keyname = nullptr;
+	if (bKeyDataDirty)
+	{
+		RebuildKeyData();
+	}
 
-	if (Key.IsGamepadKey())
+	const FText* const KeyName = KeyNames.Find(Key);
+	return KeyName != nullptr ? *KeyName : Key.GetDisplayName();
+}
+
+void UUINavPCComponent::GetEnhancedInputKeys(const UInputAction* Action, TArray<FKey>& OutKeys)
+{
+	if (!IsValid(Action))
 	{
-		if (CurrentPlatformData.GamepadKeyNameData != nullptr && CurrentPlatformData.GamepadKeyNameData->GetRowMap().Contains(Key.GetFName()))
-		{
-			Keyname = reinterpret_cast<FInputNameMapping*>(CurrentPlatformData.GamepadKeyNameData->GetRowMap()[Key.GetFName()]);
-		}
+		return;
 	}
-	else
+
+	if (const TArray<FKey>* const CachedKeys = InputKeysCache.Find(Action))
 	{
-		if (CurrentPlatformData.bCanUseKeyboardMouse && KeyboardMouseKeyNameData != nullptr && KeyboardMouseKeyNameData->GetRowMap().Contains(Key.GetFName()))
-		{
-			Keyname = reinterpret_cast<FInputNameMapping*>(KeyboardMouseKeyNameData->GetRowMap()[Key.GetFName()]);
-		}
+		OutKeys.Append(*CachedKeys);
+		return;
 	}
 
-	return Keyname != nullptr ? Keyname->InputText : Key.GetDisplayName();
+	TArray<FKey> FoundKeys;
+	FindEnhancedInputKeys(Action, FoundKeys);
+	OutKeys.Append(FoundKeys);
+	InputKeysCache.Add(Action, MoveTemp(FoundKeys));
 }
 
-void UUINavPCComponent::GetEnhancedInputKeys(const UInputAction* Action, TArray<FKey>& OutKeys)
+void UUINavPCComponent::FindEnhancedInputKeys(const UInputAction* Action, TArray<FKey>& OutKeys)
 {
 	if (UUINavBlueprintFunctionLibrary::IsUINavInputAction(Action))
 	{
@@ -1817,6 +2692,7 @@ void UUINavPCComponent::NotifyInputTypeChange(const EInputType NewInputType, con
 
 	IUINavPCReceiver::Execute_OnInputChanged(GetOwner(), OldInputType, CurrentInputType);
 	InputTypeChangedDelegate.Broadcast(CurrentInputType);
+	ForceUpdateAllInputDisplays();
 	UpdateInputIconsDelegate.Broadcast();
 }
 
@@ -2,4 +2,21 @@
 
 
 #include "UINavSectionButton.h"
+#include "UINavWidget.h"
+#include "Components/Button.h"
+
+void UUINavSectionButtonBinding::Bind(UButton* Button, UUINavWidget* Widget, const int32 Index)
+{
+	OwningWidget = Widget;
+	SectionIndex = Index;
+	Button->OnClicked.AddUniqueDynamic(this, &UUINavSectionButtonBinding::OnClicked);
+}
+
+void UUINavSectionButtonBinding::OnClicked()
+{
+	if (IsValid(OwningWidget))
+	{
+		OwningWidget->OnSectionButtonClicked(SectionIndex);
+	}
+}
 
@@ -2,6 +2,41 @@
 
 #include "UINavSettings.h"
 
+void UUINavSettings::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	RebuildAllowedWidgetTypesToFocus();
+}
+
+void UUINavSettings::PostReloadConfig(FProperty* PropertyThatWasLoaded)
+{
+	Super::PostReloadConfig(PropertyThatWasLoaded);
+
+	RebuildAllowedWidgetTypesToFocus();
+}
+
+#if WITH_EDITOR
+void UUINavSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UUINavSettings, AllowedWidgetTypesToFocus))
+	{
+		RebuildAllowedWidgetTypesToFocus();
+	}
+}
+#endif
+
+void UUINavSettings::RebuildAllowedWidgetTypesToFocus()
+{
+	AllowedWidgetTypeNamesToFocus.Reset();
+	for (const FString& WidgetType : AllowedWidgetTypesToFocus)
+	{
+		AllowedWidgetTypeNamesToFocus.Add(FName(*WidgetType));
+	}
+}
+
 
 
 
@@ -13,8 +13,10 @@
 #include "UINavBlueprintFunctionLibrary.h"
 #include "UINavButtonBase.h"
 #include "UINavMacros.h"
+#include "UINavStats.h"
 #include "UINavSectionsWidget.h"
 #include "UINavSectionButton.h"
+#include "Components/SizeBox.h"
 #include "ComponentActions/UINavComponentAction.h"
 #include "Blueprint/UserWidget.h"
 #include "Blueprint/WidgetTree.h"
@@ -30,6 +32,9 @@
 #include "Components/CanvasPanelSlot.h"
 #include "Components/ActorComponent.h"
 #include "Components/ListView.h"
+#include "Components/TileView.h"
+#include "Blueprint/IUserListEntry.h"
+#include "Blueprint/IUserObjectListEntry.h"
 #include "Components/WidgetSwitcher.h"
 #include "Engine/GameViewportClient.h"
 #include "Engine/ViewportSplitScreen.h"
@@ -93,6 +98,7 @@ void UUINavWidget::NativeConstruct()
 		if (bShouldDestroyParent)
 		{
 			ParentWidget = OuterParentWidget->ParentWidget;
+			OuterParentWidget->ReleaseToPool();
 			OuterParentWidget = nullptr;
 		}
 	}
@@ -122,6 +128,8 @@ void UUINavWidget::NativeConstruct()
 
 void UUINavWidget::InitialSetup(const bool bRebuilding)
 {
+	UINAV_SCOPE_CYCLE_COUNTER(STAT_UINavInitialSetup);
+
 	if (!bRebuilding)
 	{
 		if (UINavPC == nullptr)
@@ -137,6 +145,7 @@ void UUINavWidget::InitialSetup(const bool bRebuilding)
 		}
 
 		bSetupStarted = true;
+		SetupStartFrame = GFrameCounter;
 	}
 
 	TraverseHierarchy();
@@ -151,13 +160,15 @@ void UUINavWidget::InitialSetup(const bool bRebuilding)
 	else
 	{
 		SetupSelector();
-		UINavSetupWaitForTick = 0;
+		bPendingUINavSetup = true;
+		RequestLayoutReadyCallback();
 	}
 }
 
 void UUINavWidget::ReconfigureSetup()
 {
 	bSetupStarted = true;
+	SetupStartFrame = GFrameCounter;
 
 	if (!IsSelectorValid())
 	{
@@ -166,7 +177,8 @@ void UUINavWidget::ReconfigureSetup()
 	else
 	{
 		SetupSelector();
-		UINavSetupWaitForTick = 0;
+		bPendingUINavSetup = true;
+		RequestLayoutReadyCallback();
 	}
 
 	for (UUINavWidget* ChildUINavWidget : ChildUINavWidgets)
@@ -207,6 +219,8 @@ void UUINavWidget::ConfigureUINavPC()
 
 void UUINavWidget::TraverseHierarchy()
 {
+	UINAV_SCOPE_CYCLE_COUNTER(STAT_UINavTraverseHierarchy);
+
 	//Find UINavButtons in the widget hierarchy
 	TArray<UWidget*> Widgets;
 	WidgetTree->GetAllWidgets(Widgets);
@@ -215,10 +229,63 @@ void UUINavWidget::TraverseHierarchy()
 		UUINavWidget* ChildUINavWidget = Cast<UUINavWidget>(Widget);
 		if (ChildUINavWidget != nullptr)
 		{
-			ChildUINavWidget->AddParentToPath(ChildUINavWidgets.Num());
 			ChildUINavWidgets.Add(ChildUINavWidget);
 		}
 	}
+
+	GetMostOuterUINavWidget()->RebuildWidgetPathTable();
+}
+
+void UUINavWidget::RebuildWidgetPathTable()
+{
+	int32 Counter = 0;
+	BuildWidgetPathTable(this, nullptr, INDEX_NONE, Counter);
+}
+
+void UUINavWidget::BuildWidgetPathTable(UUINavWidget* Root, UUINavWidget* Parent, const int IndexInParent, int32& Counter)
+{
+	PathRoot = Root;
+	PathParent = Parent;
+	PathDepth = Parent != nullptr ? Parent->PathDepth + 1 : 0;
+	PathEnter = Counter++;
+
+	if (Parent != nullptr)
+	{
+		UINavWidgetPath = Parent->UINavWidgetPath;
+		UINavWidgetPath.Add(IndexInParent);
+	}
+	else
+	{
+		UINavWidgetPath.Reset();
+	}
+
+	for (int ChildIndex = 0; ChildIndex < ChildUINavWidgets.Num(); ++ChildIndex)
+	{
+		if (IsValid(ChildUINavWidgets[ChildIndex]))
+		{
+			ChildUINavWidgets[ChildIndex]->BuildWidgetPathTable(Root, this, ChildIndex, Counter);
+		}
+	}
+
+	PathExit = Counter - 1;
+}
+
+bool UUINavWidget::IsDescendantOf(const UUINavWidget* const Ancestor, const bool bIncludeSelf /*= true*/) const
+{
+	if (!IsValid(Ancestor))
+	{
+		return false;
+	}
+
+	if (Ancestor == this)
+	{
+		return bIncludeSelf;
+	}
+
+	return PathRoot != nullptr &&
+		PathRoot == Ancestor->PathRoot &&
+		PathEnter > Ancestor->PathEnter &&
+		PathEnter <= Ancestor->PathExit;
 }
 
 void UUINavWidget::SetupSections()
@@ -282,55 +349,29 @@ void UUINavWidget::SetupSections()
 		}
 	}
 
-	for (int i = 0; i < SectionButtons.Num(); ++i)
-	{
-		switch (i)
-		{
-		case 0:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed1);
-			break;
-		case 1:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed2);
-			break;
-		case 2:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed3);
-			break;
-		case 3:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed4);
-			break;
-		case 4:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed5);
-			break;
-		case 5:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed6);
-			break;
-		case 6:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed7);
-			break;
-		case 7:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed8);
-			break;
-		case 8:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed9);
-			break;
-		case 9:
-			SectionButtons[i]->OnClicked.AddUniqueDynamic(this, &UUINavWidget::OnSectionButtonPressed10);
-			break;
-		}
-	}
-
-	if (SectionWidgets.IsEmpty())
+	for (int i = SectionButtonBindings.Num(); i < SectionButtons.Num(); ++i)
 	{
-		static const TArray<TSubclassOf<UWidget>> WidgetClassArray = { UUINavWidget::StaticClass(), UUINavComponent::StaticClass() };
-		for (UWidget* const ChildWidget : UINavSwitcher->GetAllChildren())
+		UUINavSectionButtonBinding* SectionButtonBinding = NewObject<UUINavSectionButtonBinding>(this);
+		SectionButtonBinding->Bind(SectionButtons[i], this, i);
+		SectionButtonBindings.Add(SectionButtonBinding);
+	}
+
+	if (FirstLazySectionIndex == INDEX_NONE && !LazySectionClasses.IsEmpty())
+	{
+		FirstLazySectionIndex = UINavSwitcher->GetChildrenCount();
+		for (int i = 0; i < LazySectionClasses.Num(); ++i)
 		{
-			UWidget* TargetWidget = UUINavBlueprintFunctionLibrary::FindWidgetOfClassesInWidget(ChildWidget, WidgetClassArray);
-			if (IsValid(TargetWidget))
-			{
-				SectionWidgets.Add(TargetWidget);
-			}
+			USizeBox* LazySectionSlot = WidgetTree->ConstructWidget<USizeBox>();
+			UINavSwitcher->AddChild(LazySectionSlot);
+			LazySectionSlots.Add(LazySectionSlot);
 		}
 	}
+
+	SectionWidgets.SetNumZeroed(UINavSwitcher->GetChildrenCount());
+
+	const int32 ActiveIndex = UINavSwitcher->GetActiveWidgetIndex();
+	PreloadSection(ActiveIndex);
+	PreloadAdjacentSections(ActiveIndex);
 }
 
 void UUINavWidget::SetupSelector()
@@ -395,6 +436,9 @@ void UUINavWidget::UINavSetup()
 	ReturnedFromWidget = nullptr;
 	IgnoreHoverComponent = nullptr;
 
+	SetupLatencyFrames = static_cast<int32>(GFrameCounter - SetupStartFrame);
+	SET_DWORD_STAT(STAT_UINavWidgetSetupLatencyFrames, SetupLatencyFrames);
+
 	PropagateOnSetupCompleted();
 }
 
@@ -438,9 +482,7 @@ void UUINavWidget::GainNavigation(UUINavWidget* PreviousActiveWidget)
 
 	bHasNavigation = true;
 
-	const bool bPreviousWidgetIsChild = PreviousActiveWidget != nullptr ?
-                                    UUINavBlueprintFunctionLibrary::ContainsArray<int>(PreviousActiveWidget->GetUINavWidgetPath(), UINavWidgetPath) :
-                                    false;
+	const bool bPreviousWidgetIsChild = PreviousActiveWidget != nullptr && PreviousActiveWidget->IsDescendantOf(this);
 	OnGainedNavigation(PreviousActiveWidget, bPreviousWidgetIsChild);
 }
 
@@ -507,9 +549,8 @@ void UUINavWidget::LoseNavigation(UUINavWidget* NewActiveWidget)
 
 	const bool bHaveSameOuter = IsValid(NewActiveWidget) ? NewActiveWidget->GetMostOuterUINavWidget() == GetMostOuterUINavWidget() : false;
 
-	const bool bNewWidgetIsChild = NewActiveWidget != nullptr && NewActiveWidget->GetUINavWidgetPath().Num() > 0 ?
-		UUINavBlueprintFunctionLibrary::ContainsArray<int>(NewActiveWidget->GetUINavWidgetPath(), UINavWidgetPath) && bHaveSameOuter :
-		false;
+	const bool bNewWidgetIsChild = NewActiveWidget != nullptr && NewActiveWidget->GetPathParent() != nullptr &&
+		NewActiveWidget->IsDescendantOf(this) && bHaveSameOuter;
 
 	if (bNewWidgetIsChild && !bMaintainNavigationForChild)
 	{
@@ -562,6 +603,10 @@ void UUINavWidget::SetCurrentComponent(UUINavComponent* Component)
 void UUINavWidget::SetHoveredComponent(UUINavComponent* Component)
 {
 	HoveredComponent = Component;
+	if (Component != nullptr)
+	{
+		RequestNativeTick();
+	}
 
 	if (IsValid(OuterUINavWidget) && !OuterUINavWidget->bMaintainNavigationForChild)
 	{
@@ -597,14 +642,9 @@ bool UUINavWidget::IsNavigationKeyPressed(const EUINavigation NavigationEvent) c
 	}
 
 	TSharedRef<FUINavigationConfig> NavConfig = StaticCastSharedRef<FUINavigationConfig>(FSlateApplication::Get().GetNavigationConfig());
-	for (const TPair<FKey, EUINavigation>& KeyEventRule : NavConfig->KeyEventRules)
+	for (const FKey& Key : NavConfig->GetKeysForDirection(NavigationEvent))
 	{
-		if (KeyEventRule.Value != NavigationEvent)
-		{
-			continue;
-		}
-
-		if (UINavPC->GetPC()->IsInputKeyDown(KeyEventRule.Key))
+		if (UINavPC->GetPC()->IsInputKeyDown(Key))
 		{
 			return true;
 		}
@@ -621,14 +661,9 @@ bool UUINavWidget::IsNavigationKeyPressed(const EUINavigationAction NavigationAc
 	}
 
 	TSharedRef<FUINavigationConfig> NavConfig = StaticCastSharedRef<FUINavigationConfig>(FSlateApplication::Get().GetNavigationConfig());
-	for (const TPair<FKey, EUINavigationAction>& KeyEventRule : NavConfig->KeyActionRules)
+	for (const FKey& Key : NavConfig->GetKeysForAction(NavigationAction))
 	{
-		if (KeyEventRule.Value != NavigationAction)
-		{
-			continue;
-		}
-
-		if (UINavPC->GetPC()->IsInputKeyDown(KeyEventRule.Key))
+		if (UINavPC->GetPC()->IsInputKeyDown(Key))
 		{
 			return true;
 		}
@@ -655,39 +690,9 @@ void UUINavWidget::NativeTick(const FGeometry & MyGeometry, float DeltaTime)
 {
 	Super::NativeTick(MyGeometry, DeltaTime);
 
-	if (IsSelectorValid())
+	if (bMovingSelector && IsSelectorValid())
 	{
-		if (UINavSetupWaitForTick >= 0)
-		{
-			if (UINavSetupWaitForTick >= 1)
-			{
-				UINavSetup();
-				UINavSetupWaitForTick = -1;
-			}
-			else
-			{
-				UINavSetupWaitForTick++;
-			}
-		}
-
-		if (UpdateSelectorWaitForTick >= 0)
-		{
-			if (UpdateSelectorWaitForTick >= 1)
-			{
-				if (MoveCurve != nullptr) BeginSelectorMovement(UpdateSelectorPrevComponent, UpdateSelectorNextComponent);
-				else UpdateSelectorLocation(UpdateSelectorNextComponent);
-				UpdateSelectorWaitForTick = -1;
-			}
-			else
-			{
-				UpdateSelectorWaitForTick++;
-			}
-		}
-
-		if (bMovingSelector)
-		{
-			HandleSelectorMovement(DeltaTime);
-		}
+		HandleSelectorMovement(DeltaTime);
 	}
 
 	if (bUpdateMousePositionNextFrame && !CurrentComponent->NavButton->GetCachedGeometry().GetLocalSize().IsNearlyZero())
@@ -700,6 +705,111 @@ void UUINavWidget::NativeTick(const FGeometry & MyGeometry, float DeltaTime)
 	{
 		OnUnhoveredComponent(HoveredComponent);
 	}
+
+	if (CanStopTicking())
+	{
+		if (const TSharedPtr<SWidget> CachedWidget = GetCachedWidget())
+		{
+			CachedWidget->SetCanTick(false);
+		}
+	}
+}
+
+void UUINavWidget::RequestNativeTick()
+{
+	if (const TSharedPtr<SWidget> CachedWidget = GetCachedWidget())
+	{
+		CachedWidget->SetCanTick(true);
+	}
+}
+
+bool UUINavWidget::CanStopTicking() const
+{
+	if (bMovingSelector || bUpdateMousePositionNextFrame || HoveredComponent != nullptr || IsAnyAnimationPlaying())
+	{
+		return false;
+	}
+
+	if (GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UUserWidget, Tick)))
+	{
+		return false;
+	}
+
+	const UWorld* const World = GetWorld();
+	return !IsValid(World) || World->GetLatentActionManager().GetNumActionsForObject(const_cast<UUINavWidget*>(this)) == 0;
+}
+
+void UUINavWidget::RequestLayoutReadyCallback()
+{
+	if (LayoutReadyHandle.IsValid() || !FSlateApplication::IsInitialized())
+	{
+		return;
+	}
+
+	LayoutReadyHandle = FSlateApplication::Get().OnPostTick().AddUObject(this, &UUINavWidget::OnLayoutReady);
+}
+
+void UUINavWidget::OnLayoutReady(const float DeltaTime)
+{
+	// Slate has ticked, but this widget hasn't been laid out yet (e.g. it's still collapsed), so its components' geometry isn't valid
+	if (!IsSelectorValid() || GetCachedGeometry().GetLocalSize().IsNearlyZero())
+	{
+		return;
+	}
+
+	if (bPendingUINavSetup)
+	{
+		bPendingUINavSetup = false;
+		UINavSetup();
+	}
+
+	// Setup may have requested a selector update as well, which can be handled right away
+	if (bPendingSelectorUpdate)
+	{
+		bPendingSelectorUpdate = false;
+		if (MoveCurve != nullptr) BeginSelectorMovement(UpdateSelectorPrevComponent, UpdateSelectorNextComponent);
+		else UpdateSelectorLocation(UpdateSelectorNextComponent);
+	}
+
+	if (!bPendingUINavSetup && !bPendingSelectorUpdate)
+	{
+		StopWaitingForLayout();
+	}
+}
+
+void UUINavWidget::StopWaitingForLayout()
+{
+	if (LayoutReadyHandle.IsValid() && FSlateApplication::IsInitialized())
+	{
+		FSlateApplication::Get().OnPostTick().Remove(LayoutReadyHandle);
+	}
+	LayoutReadyHandle.Reset();
+}
+
+void UUINavWidget::NativeDestruct()
+{
+	StopWaitingForLayout();
+	bPendingUINavSetup = false;
+	bPendingSelectorUpdate = false;
+
+	SpatialIndices.Reset();
+	SpatialIndexScrollBoxes.Reset();
+	DirtySpatialIndexComponents.Reset();
+	SpatialIndexLayoutSize = FVector2D::ZeroVector;
+
+	for (const TWeakObjectPtr<UListView>& BoundListView : BoundListViews)
+	{
+		if (UListView* ListView = BoundListView.Get())
+		{
+			ListView->OnItemScrolledIntoView().RemoveAll(this);
+		}
+	}
+	BoundListViews.Reset();
+	PendingListView.Reset();
+	PendingListItem.Reset();
+	PendingListIndex = INDEX_NONE;
+
+	Super::NativeDestruct();
 }
 
 void UUINavWidget::RemoveFromParent()
@@ -794,11 +904,12 @@ void UUINavWidget::HandleOnFocusChanging(UUINavWidget* Widget, UUINavComponent*
 		return;
 	}
 
-	const FString LastWidgetTypeStr = NewWidgetPath.GetLastWidget()->GetTypeAsString();
-	const bool LastWidgetIsButton = LastWidgetTypeStr == TEXT("SButton");
+	static const FName ButtonType(TEXT("SButton"));
+	const FName LastWidgetType = NewWidgetPath.GetLastWidget()->GetType();
+	const bool LastWidgetIsButton = LastWidgetType == ButtonType;
 	UUserWidget* ParentWidget = LastWidgetIsButton ? UUINavWidget::FindUserWidgetInWidgetPath(NewWidgetPath, NewWidgetPath.GetLastWidget()) : nullptr;
 	if (InFocusEvent.GetCause() == EFocusCause::WindowActivate ||
-		!UINavSettings->AllowedWidgetTypesToFocus.Contains(LastWidgetTypeStr) ||
+		!UINavSettings->IsWidgetTypeAllowedToFocus(LastWidgetType) ||
 		(LastWidgetIsButton && !IsValid(ParentWidget)))
 	{
 		if (const UWorld* const World = Widget->GetWorld())
@@ -824,11 +935,13 @@ void UUINavWidget::HandleOnFocusChanging(UUINavWidget* Widget, UUINavComponent*
 		return;
 	}
 
-	if (IsValid(Component))
+	// A component receiving focus events has been constructed, so its cached widgets can be used instead of TakeWidget
+	const SWidget* const ComponentWidget = IsValid(Component) ? Component->GetCachedWidget().Get() : nullptr;
+	if (ComponentWidget != nullptr)
 	{
-		const bool bHadFocus = PreviousFocusPath.ContainsWidget(&Component->TakeWidget().Get());
-		const bool bHasFocus = NewWidgetPath.ContainsWidget(&Component->TakeWidget().Get());
-		const bool bHasButtonFocus = NewWidgetPath.ContainsWidget(&Component->NavButton->TakeWidget().Get());
+		const bool bHadFocus = PreviousFocusPath.ContainsWidget(ComponentWidget);
+		const bool bHasFocus = NewWidgetPath.ContainsWidget(ComponentWidget);
+		const bool bHasButtonFocus = bHasFocus && NewWidgetPath.ContainsWidget(Component->NavButton->GetCachedWidget().Get());
 
 		if (!bHadFocus && bHasFocus)
 		{
@@ -912,6 +1025,8 @@ void UUINavWidget::HandleOnNavigation(FNavigationReply& Reply, UUINavWidget* Wid
 
 void UUINavWidget::HandleOnKeyDown(FReply& Reply, UUINavWidget* Widget, UUINavComponent* Component, const FKeyEvent& InKeyEvent)
 {
+	UINAV_SCOPE_CYCLE_COUNTER(STAT_UINavHandleOnKeyDown);
+
 	if (!IsValid(Widget) || !IsValid(Widget->UINavPC) || InKeyEvent.IsRepeat())
 	{
 		return;
@@ -1029,39 +1144,92 @@ void UUINavWidget::HandleSelectorMovement(const float DeltaTime)
 		return;
 	}
 
-	SetSelectorLocation(SelectorOrigin + Distance * MoveCurve->GetFloatValue(MovementCounter));
+	SetSelectorLocation(SelectorOrigin + Distance * GetMoveCurveValue(MovementCounter));
+}
+
+void UUINavWidget::SampleMoveCurve()
+{
+	// Enough samples for the linear interpolation between them to be indistinguishable from the curve at selector speeds
+	constexpr int32 NumMoveCurveSamples = 64;
+
+	float MinTime, MaxTime;
+	MoveCurve->GetTimeRange(MinTime, MaxTime);
+	MovementTime = MaxTime - MinTime;
+
+	MoveCurveSamples.SetNumUninitialized(NumMoveCurveSamples + 1);
+	for (int32 SampleIndex = 0; SampleIndex <= NumMoveCurveSamples; ++SampleIndex)
+	{
+		MoveCurveSamples[SampleIndex] = MoveCurve->GetFloatValue(MovementTime * SampleIndex / NumMoveCurveSamples);
+	}
+
+	SampledMoveCurve = MoveCurve;
+}
+
+float UUINavWidget::GetMoveCurveValue(const float Time) const
+{
+	const int32 NumIntervals = MoveCurveSamples.Num() - 1;
+	if (NumIntervals <= 0 || MovementTime <= 0.0f)
+	{
+		return MoveCurveSamples.Num() > 0 ? MoveCurveSamples.Last() : 1.0f;
+	}
+
+	const float SamplePosition = FMath::Clamp(Time / MovementTime, 0.0f, 1.0f) * NumIntervals;
+	const int32 SampleIndex = FMath::Min(FMath::FloorToInt(SamplePosition), NumIntervals - 1);
+	return FMath::Lerp(MoveCurveSamples[SampleIndex], MoveCurveSamples[SampleIndex + 1], SamplePosition - SampleIndex);
+}
+
+void UUINavWidget::InvalidateSelectorCache()
+{
+	SelectorOffsetLayoutSize = FVector2D(-1.0f, -1.0f);
+	SampledMoveCurve.Reset();
+	MoveCurveSamples.Reset();
 }
 
 FVector2D UUINavWidget::GetSelectorLocationOffset(const bool bAbsolute /*= true*/)
 {
+	if (!bAbsolute)
+	{
+		return FVector2D::ZeroVector;
+	}
+
+	const FVector2D LayoutSize = GetCachedGeometry().GetLocalSize();
+	if (LayoutSize == SelectorOffsetLayoutSize)
+	{
+		return CachedSelectorLocationOffset;
+	}
+
 	FVector2D Offset = FVector2D::ZeroVector;
-	if (bAbsolute)
+	const UPanelSlot* const SelectorPanelSlot = Cast<UPanelSlot>(TheSelector->Slot);
+	if (IsValid(SelectorPanelSlot))
 	{
-		const UPanelSlot* const SelectorPanelSlot = Cast<UPanelSlot>(TheSelector->Slot);
-		if (IsValid(SelectorPanelSlot))
+		const UCanvasPanel* CanvasPanel = Cast<UCanvasPanel>(SelectorPanelSlot->Parent);
+		while (IsValid(CanvasPanel))
 		{
-			const UCanvasPanel* CanvasPanel = Cast<UCanvasPanel>(SelectorPanelSlot->Parent);
-			while (IsValid(CanvasPanel))
+			if (!IsValid(CanvasPanel->Slot))
 			{
-				if (!IsValid(CanvasPanel->Slot))
-				{
-					break;
-				}
-
-				const UCanvasPanelSlot* const CanvasPanelSlot = Cast<UCanvasPanelSlot>(CanvasPanel->Slot);
-				if (IsValid(CanvasPanelSlot))
-				{
-					const FVector2D LocalSize = CanvasPanel->GetCachedGeometry().GetLocalSize();
-					const FAnchors CanvasAnchors = CanvasPanelSlot->GetAnchors();
-					Offset.X += (LocalSize.X * CanvasAnchors.Minimum.X) / (CanvasAnchors.Maximum.X - CanvasAnchors.Minimum.X);
-					Offset.Y += (LocalSize.Y * CanvasAnchors.Minimum.Y) / (CanvasAnchors.Maximum.Y - CanvasAnchors.Minimum.Y);
-				}
+				break;
+			}
 
-				CanvasPanel = Cast<UCanvasPanel>(CanvasPanel->Slot->Parent);
+			const UCanvasPanelSlot* const CanvasPanelSlot = Cast<UCanvasPanelSlot>(CanvasPanel->Slot);
+			if (IsValid(CanvasPanelSlot))
+			{
+				const FVector2D LocalSize = CanvasPanel->GetCachedGeometry().GetLocalSize();
+				const FAnchors CanvasAnchors = CanvasPanelSlot->GetAnchors();
+				Offset.X += (LocalSize.X * CanvasAnchors.Minimum.X) / (CanvasAnchors.Maximum.X - CanvasAnchors.Minimum.X);
+				Offset.Y += (LocalSize.Y * CanvasAnchors.Minimum.Y) / (CanvasAnchors.Maximum.Y - CanvasAnchors.Minimum.Y);
 			}
+
+			CanvasPanel = Cast<UCanvasPanel>(CanvasPanel->Slot->Parent);
 		}
 	}
 
+	// Until this widget has been laid out the canvas sizes aren't known yet, so don't cache anything
+	if (!LayoutSize.IsZero())
+	{
+		CachedSelectorLocationOffset = Offset;
+		SelectorOffsetLayoutSize = LayoutSize;
+	}
+
 	return Offset;
 }
 
@@ -1072,7 +1240,11 @@ FVector2D UUINavWidget::GetSelectorLocation(const bool bAbsolute /*= true*/)
 
 void UUINavWidget::SetSelectorLocation(const FVector2D& NewLocation, const bool bAbsolute /*= true*/)
 {
-	TheSelector->SetRenderTranslation(NewLocation - GetSelectorLocationOffset(bAbsolute));
+	const FVector2D NewTranslation = NewLocation - GetSelectorLocationOffset(bAbsolute);
+	if (TheSelector->GetRenderTransform().Translation != NewTranslation)
+	{
+		TheSelector->SetRenderTranslation(NewTranslation);
+	}
 }
 
 void UUINavWidget::SetFocusOnComponent(UUINavComponent* Component)
@@ -1134,12 +1306,13 @@ void UUINavWidget::GoToPreviousSection()
 void UUINavWidget::GoToSection(const int32 SectionIndex)
 {
 	if (!IsValid(UINavSwitcher) ||
-		!IsValid(UINavSwitcher->GetWidgetAtIndex(SectionIndex)) ||
-		!SectionWidgets.IsValidIndex(SectionIndex))
+		!IsValid(UINavSwitcher->GetWidgetAtIndex(SectionIndex)))
 	{
 		return;
 	}
 
+	PreloadSection(SectionIndex);
+
 	if (UINavSwitcher->GetActiveWidgetIndex() == SectionIndex)
 	{
 		UINavSwitcher->GetActiveWidget()->SetFocus();
@@ -1148,62 +1321,99 @@ void UUINavWidget::GoToSection(const int32 SectionIndex)
 	
 	const int32 OldIndex = UINavSwitcher->GetActiveWidgetIndex();
 	UINavSwitcher->SetActiveWidgetIndex(SectionIndex);
-	UWidget* TargetWidget = SectionWidgets[SectionIndex];
+	UWidget* TargetWidget = GetSectionWidget(SectionIndex);
 	if (IsValid(TargetWidget))
 	{
 		TargetWidget->SetFocus();
 	}
 	OnChangedSection(OldIndex, SectionIndex);
-}
 
-void UUINavWidget::OnSectionButtonPressed1()
-{
-	GoToSection(0);
+	PreloadAdjacentSections(SectionIndex);
 }
 
-void UUINavWidget::OnSectionButtonPressed2()
+void UUINavWidget::PreloadSection(const int32 SectionIndex)
 {
-	GoToSection(1);
-}
+	if (FirstLazySectionIndex == INDEX_NONE || !LazySectionSlots.IsValidIndex(SectionIndex - FirstLazySectionIndex))
+	{
+		return;
+	}
 
-void UUINavWidget::OnSectionButtonPressed3()
-{
-	GoToSection(2);
-}
+	const int32 LazySectionIndex = SectionIndex - FirstLazySectionIndex;
+	USizeBox* LazySectionSlot = LazySectionSlots[LazySectionIndex];
+	if (!IsValid(LazySectionSlot) || LazySectionSlot->GetChildrenCount() > 0 || !IsValid(LazySectionClasses[LazySectionIndex]))
+	{
+		return;
+	}
 
-void UUINavWidget::OnSectionButtonPressed4()
-{
-	GoToSection(3);
-}
+	UUserWidget* SectionWidget = CreateWidget<UUserWidget>(this, LazySectionClasses[LazySectionIndex]);
+	if (!IsValid(SectionWidget))
+	{
+		return;
+	}
 
-void UUINavWidget::OnSectionButtonPressed5()
-{
-	GoToSection(4);
-}
+	LazySectionSlot->AddChild(SectionWidget);
 
-void UUINavWidget::OnSectionButtonPressed6()
-{
-	GoToSection(5);
+	if (UUINavWidget* SectionUINavWidget = Cast<UUINavWidget>(SectionWidget))
+	{
+		ChildUINavWidgets.Add(SectionUINavWidget);
+		GetMostOuterUINavWidget()->RebuildWidgetPathTable();
+	}
 }
 
-void UUINavWidget::OnSectionButtonPressed7()
+void UUINavWidget::PreloadAdjacentSections(const int32 SectionIndex)
 {
-	GoToSection(6);
-}
+	if (!bPreloadAdjacentSections || !IsValid(UINavSwitcher))
+	{
+		return;
+	}
 
-void UUINavWidget::OnSectionButtonPressed8()
-{
-	GoToSection(7);
+	const int32 NumSections = UINavSwitcher->GetChildrenCount();
+	if (NumSections <= 1)
+	{
+		return;
+	}
+
+	if (SectionIndex > 0 || bWrapAutoSectionNavigation)
+	{
+		PreloadSection((SectionIndex - 1 + NumSections) % NumSections);
+	}
+
+	if (SectionIndex < NumSections - 1 || bWrapAutoSectionNavigation)
+	{
+		PreloadSection((SectionIndex + 1) % NumSections);
+	}
 }
 
-void UUINavWidget::OnSectionButtonPressed9()
+UWidget* UUINavWidget::GetSectionWidget(const int32 SectionIndex)
 {
-	GoToSection(8);
+	if (!IsValid(UINavSwitcher))
+	{
+		return nullptr;
+	}
+
+	UWidget* const SectionRoot = UINavSwitcher->GetWidgetAtIndex(SectionIndex);
+	if (!IsValid(SectionRoot))
+	{
+		return nullptr;
+	}
+
+	if (SectionWidgets.Num() < UINavSwitcher->GetChildrenCount())
+	{
+		SectionWidgets.SetNumZeroed(UINavSwitcher->GetChildrenCount());
+	}
+
+	if (!IsValid(SectionWidgets[SectionIndex]))
+	{
+		static const TArray<TSubclassOf<UWidget>> WidgetClassArray = { UUINavWidget::StaticClass(), UUINavComponent::StaticClass() };
+		SectionWidgets[SectionIndex] = UUINavBlueprintFunctionLibrary::FindWidgetOfClassesInWidget(SectionRoot, WidgetClassArray);
+	}
+
+	return SectionWidgets[SectionIndex];
 }
 
-void UUINavWidget::OnSectionButtonPressed10()
+void UUINavWidget::OnSectionButtonClicked(const int32 SectionIndex)
 {
-	GoToSection(9);
+	GoToSection(SectionIndex);
 }
 
 void UUINavWidget::UpdateSelectorLocation(UUINavComponent* Component)
@@ -1392,6 +1602,11 @@ void UUINavWidget::OnSelect_Implementation(UUINavComponent* Component)
 
 void UUINavWidget::PropagateOnSelect(UUINavComponent* Component)
 {
+	if (IsValid(UINavPC))
+	{
+		UINavPC->CloseInputLatencySpan(EInputLatencyType::Select);
+	}
+
 	OnSelect(Component);
 	if (IsValid(OuterUINavWidget) && !OuterUINavWidget->bMaintainNavigationForChild)
 	{
@@ -1435,7 +1650,8 @@ void UUINavWidget::UpdateNavigationVisuals(UUINavComponent* Component, const boo
 	{
 		UpdateSelectorPrevComponent = CurrentComponent;
 		UpdateSelectorNextComponent = Component;
-		UpdateSelectorWaitForTick = 0;
+		bPendingSelectorUpdate = true;
+		RequestLayoutReadyCallback();
 	}
 
 	UpdateTextColor(Component);
@@ -1453,12 +1669,14 @@ void UUINavWidget::BeginSelectorMovement(UUINavComponent* FromComponent, UUINavC
 	SelectorDestination = GetSelectorLocationForButton(ToComponent);
 	Distance = SelectorDestination - SelectorOrigin;
 
-	float MinTime, MaxTime;
-	MoveCurve->GetTimeRange(MinTime, MaxTime);
-	MovementTime = MaxTime - MinTime;
+	if (SampledMoveCurve.Get() != MoveCurve)
+	{
+		SampleMoveCurve();
+	}
 	MovementCounter = 0.0f;
 
 	bMovingSelector = true;
+	RequestNativeTick();
 }
 
 void UUINavWidget::AttemptUnforceNavigation(const EInputType NewInputType)
@@ -1650,14 +1868,15 @@ void UUINavWidget::PropagateOnHorizCompUpdated(UUINavComponent* Component)
 
 UUINavWidget* UUINavWidget::GoToWidget(TSubclassOf<UUINavWidget> NewWidgetClass, const bool bRemoveParent /*= true*/, const bool bDestroyParent, const int ZOrder)
 {
+	UINAV_SCOPE_CYCLE_COUNTER(STAT_UINavGoToWidget);
+
 	if (NewWidgetClass == nullptr)
 	{
 		DISPLAYERROR("GoToWidget: No Widget Class found");
 		return nullptr;
 	}
 
-	APlayerController* PC = Cast<APlayerController>(UINavPC->GetOwner());
-	UUINavWidget* NewWidget = CreateWidget<UUINavWidget>(PC, NewWidgetClass);
+	UUINavWidget* NewWidget = UINavPC->AcquirePooledWidget(NewWidgetClass);
 	return GoToBuiltWidget(NewWidget, bRemoveParent, bDestroyParent, ZOrder);
 }
 
@@ -1677,6 +1896,7 @@ UUINavWidget* UUINavWidget::GoToPromptWidget(TSubclassOf<UUINavPromptWidget> New
 
 	APlayerController* PC = Cast<APlayerController>(UINavPC->GetOwner());
 	UUINavPromptWidget* NewWidget = CreateWidget<UUINavPromptWidget>(PC, NewWidgetClass);
+	INC_DWORD_STAT(STAT_UINavWidgetsCreated);
 	NewWidget->Title = Title;
 	NewWidget->Message = Message;
 	NewWidget->SetCallback(Event);
@@ -1766,6 +1986,7 @@ void UUINavWidget::ReturnToParent(const bool bRemoveAllParents, const int ZOrder
 				bReturningToParent = true;
 				RemoveFromParent();
 			}
+			ReleaseToPool();
 		}
 		return;
 	}
@@ -1790,6 +2011,7 @@ void UUINavWidget::ReturnToParent(const bool bRemoveAllParents, const int ZOrder
 			}
 
 			WidgetComp->SetWidget(ParentWidget);
+			ReleaseToPool();
 		}
 	}
 	else
@@ -1821,6 +2043,7 @@ void UUINavWidget::ReturnToParent(const bool bRemoveAllParents, const int ZOrder
 				}
 				bReturningToParent = true;
 				RemoveFromParent();
+				ReleaseToPool();
 			}
 		}
 		else
@@ -1840,6 +2063,34 @@ void UUINavWidget::RemoveSelfAndAllParents()
 	}
 	bReturningToParent = true;
 	RemoveFromParent();
+	ReleaseToPool();
+}
+
+void UUINavWidget::ReleaseToPool()
+{
+	if (!bAcquiredFromPool || !IsValid(UINavPC)) return;
+
+	UINavPC->ReleasePooledWidget(this);
+}
+
+void UUINavWidget::ResetForPool()
+{
+	ParentWidget = nullptr;
+	ReturnedFromWidget = nullptr;
+	bParentRemoved = false;
+	bShouldDestroyParent = false;
+	WidgetComp = nullptr;
+
+	SelectCount = 0;
+	SelectedComponent = nullptr;
+	HoveredComponent = nullptr;
+	IgnoreHoverComponent = nullptr;
+
+	bMovingSelector = false;
+	bReturningToParent = false;
+	bUpdateMousePositionNextFrame = false;
+
+	OnReturnedToPool();
 }
 
 int UUINavWidget::GetWidgetHierarchyDepth(UWidget* Widget) const
@@ -1866,6 +2117,8 @@ void UUINavWidget::NavigatedTo(UUINavComponent* NavigatedToComponent, const bool
 
 	const bool bHadNavigation = bHasNavigation;
 
+	UINavPC->CloseInputLatencySpan(EInputLatencyType::Navigation);
+
 	if (bNotifyUINavPC)
 	{
 		UINavPC->NotifyNavigatedTo(this);
@@ -1911,6 +2164,7 @@ void UUINavWidget::NavigatedTo(UUINavComponent* NavigatedToComponent, const bool
 	if (MouseRelativePosition != ESelectorPosition::None && UINavPC->GetCurrentInputType() != EInputType::Mouse)
 	{
 		bUpdateMousePositionNextFrame = true;
+		RequestNativeTick();
 	}
 }
 
@@ -2059,16 +2313,6 @@ EThumbstickAsMouse UUINavWidget::GetUseThumbstickAsMouse() const
 	return EThumbstickAsMouse::None;
 }
 
-void UUINavWidget::AddParentToPath(const int IndexInParent)
-{
-	UINavWidgetPath.EmplaceAt(0, IndexInParent);
-
-	for (UUINavWidget* ChildUINavWidget : ChildUINavWidgets)
-	{
-		ChildUINavWidget->AddParentToPath(IndexInParent);
-	}
-}
-
 void UUINavWidget::SetFirstComponent(UUINavComponent* Component)
 {
 	if (IsValid(FirstComponent))
@@ -2103,6 +2347,403 @@ void UUINavWidget::RemovedComponent(UUINavComponent* Component)
 	{
 		FirstComponent = nullptr;
 	}
+
+	if (bUseSpatialNavigationIndex)
+	{
+		RemoveFromSpatialIndex(Component);
+		DirtySpatialIndexComponents.Remove(Component);
+	}
+}
+
+void UUINavWidget::UpdateSpatialIndex(UUINavComponent* Component)
+{
+	if (!bUseSpatialNavigationIndex || !IsValid(Component))
+	{
+		return;
+	}
+
+	DirtySpatialIndexComponents.Add(Component);
+}
+
+void UUINavWidget::RebuildSpatialIndex()
+{
+	if (!bUseSpatialNavigationIndex)
+	{
+		return;
+	}
+
+	for (const TPair<TWeakObjectPtr<UUINavComponent>, TObjectKey<UScrollBox>>& Entry : SpatialIndexScrollBoxes)
+	{
+		DirtySpatialIndexComponents.Add(Entry.Key);
+	}
+
+	SpatialIndices.Reset();
+	SpatialIndexScrollBoxes.Reset();
+}
+
+UUINavComponent* UUINavWidget::FindComponentInDirection(UUINavComponent* FromComponent, const EUINavigation Direction)
+{
+	if (!bUseSpatialNavigationIndex || !IsValid(FromComponent))
+	{
+		return nullptr;
+	}
+
+	const FVector2D LayoutSize = GetCachedGeometry().GetLocalSize();
+	if (!LayoutSize.Equals(SpatialIndexLayoutSize))
+	{
+		SpatialIndexLayoutSize = LayoutSize;
+		RebuildSpatialIndex();
+	}
+
+	FlushSpatialIndex();
+
+	FBox2D FromRect;
+	if (!GetSpatialIndexRect(FromComponent, FromRect))
+	{
+		return nullptr;
+	}
+
+	if (FromComponent->ParentWidget == this)
+	{
+		AddToSpatialIndex(FromComponent, FromRect);
+	}
+
+	const auto CanNavigateTo = [](UUINavComponent* Component)
+	{
+		return IsValid(Component->NavButton) && Component->IsFocusable() && Component->CanBeNavigated();
+	};
+
+	// Components found at a stale position are moved and the search is retried, a few times at most before falling back to Slate
+	constexpr int32 MaxAttempts = 4;
+	for (int32 Attempt = 0; Attempt < MaxAttempts; ++Attempt)
+	{
+		// Each grid is searched in its own content space, and the closest result across grids wins
+		UUINavComponent* FoundComponent = nullptr;
+		FBox2D FoundIndexedRect;
+		double BestDistance = MAX_dbl;
+		double BestOffset = MAX_dbl;
+		for (auto It = SpatialIndices.CreateIterator(); It; ++It)
+		{
+			const TObjectKey<UScrollBox> ScrollBoxKey = It->Key;
+			const UScrollBox* ScrollBox = ScrollBoxKey.ResolveObjectPtr();
+			if (ScrollBoxKey != TObjectKey<UScrollBox>() && !IsValid(ScrollBox))
+			{
+				It.RemoveCurrent();
+				continue;
+			}
+
+			const FVector2D ScrollOffset = GetSpatialIndexScrollOffset(ScrollBox);
+			UUINavComponent* Candidate = It->Value.FindNext(FromComponent, FromRect.ShiftBy(ScrollOffset), Direction, CanNavigateTo);
+			const FBox2D* CandidateRect = Candidate != nullptr ? It->Value.GetRect(Candidate) : nullptr;
+			if (CandidateRect == nullptr)
+			{
+				continue;
+			}
+
+			const FBox2D CandidateLocalRect = CandidateRect->ShiftBy(-ScrollOffset);
+			double Distance;
+			double Offset;
+			if (FUINavSpatialIndex::GetNavigationScore(FromRect, CandidateLocalRect, Direction, Distance, Offset) &&
+				(Distance < BestDistance || (Distance == BestDistance && Offset < BestOffset)))
+			{
+				FoundComponent = Candidate;
+				FoundIndexedRect = CandidateLocalRect;
+				BestDistance = Distance;
+				BestOffset = Offset;
+			}
+		}
+
+		if (FoundComponent == nullptr)
+		{
+			return nullptr;
+		}
+
+		FBox2D FoundRect;
+		if (!GetSpatialIndexRect(FoundComponent, FoundRect))
+		{
+			RemoveFromSpatialIndex(FoundComponent);
+			DirtySpatialIndexComponents.Add(FoundComponent);
+			continue;
+		}
+
+		if (FoundIndexedRect.Min.Equals(FoundRect.Min) && FoundIndexedRect.Max.Equals(FoundRect.Max))
+		{
+			return FoundComponent;
+		}
+
+		AddToSpatialIndex(FoundComponent, FoundRect);
+	}
+
+	return nullptr;
+}
+
+bool UUINavWidget::GetSpatialIndexRect(const UUINavComponent* Component, FBox2D& OutRect) const
+{
+	if (!IsValid(Component) || !Component->GetCachedWidget().IsValid())
+	{
+		return false;
+	}
+
+	const FGeometry& ComponentGeometry = Component->GetCachedGeometry();
+	if (ComponentGeometry.GetLocalSize().IsNearlyZero())
+	{
+		return false;
+	}
+
+	const FGeometry& WidgetGeometry = GetCachedGeometry();
+	const FVector2D TopLeft = WidgetGeometry.AbsoluteToLocal(ComponentGeometry.LocalToAbsolute(FVector2D::ZeroVector));
+	const FVector2D BottomRight = WidgetGeometry.AbsoluteToLocal(ComponentGeometry.LocalToAbsolute(ComponentGeometry.GetLocalSize()));
+	OutRect = FBox2D(TopLeft.ComponentMin(BottomRight), TopLeft.ComponentMax(BottomRight));
+	return true;
+}
+
+bool UUINavWidget::TryNavigateListView(UUINavComponent* FromComponent, const EUINavigation Direction)
+{
+	if (!bUseListViewNavigation)
+	{
+		return false;
+	}
+
+	UUserWidget* EntryWidget = GetListEntryWidget(FromComponent);
+	if (EntryWidget == nullptr)
+	{
+		return false;
+	}
+
+	UListView* ListView = Cast<UListView>(UUserListEntryLibrary::GetOwningListView(EntryWidget));
+	if (!IsValid(ListView))
+	{
+		return false;
+	}
+
+	// When chaining navigation faster than entries are generated, keep counting from the item that's still pending
+	const int32 Index = PendingListView.Get() == ListView && PendingListIndex != INDEX_NONE ?
+		PendingListIndex :
+		ListView->GetIndexForItem(UUserObjectListEntryLibrary::GetListItemObject(EntryWidget));
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const int32 NewIndex = GetListIndexInDirection(ListView, Index, Direction);
+	if (NewIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	NavigateToListIndex(ListView, NewIndex);
+	return true;
+}
+
+void UUINavWidget::NavigateToListIndex(UListView* ListView, const int32 Index)
+{
+	if (!IsValid(ListView))
+	{
+		return;
+	}
+
+	if (!BoundListViews.Contains(ListView))
+	{
+		ListView->OnItemScrolledIntoView().AddUObject(this, &UUINavWidget::OnListItemScrolledIntoView);
+		BoundListViews.Add(ListView);
+	}
+
+	UObject* Item = ListView->GetItemAt(Index);
+	ListView->ScrollIndexIntoView(Index);
+
+	if (UUserWidget* EntryWidget = ListView->GetEntryWidgetFromItem(Item))
+	{
+		if (UUINavComponent* EntryComponent = FindComponentInListEntry(EntryWidget))
+		{
+			PendingListView.Reset();
+			PendingListItem.Reset();
+			PendingListIndex = INDEX_NONE;
+			SetFocusOnComponent(EntryComponent);
+			return;
+		}
+	}
+
+	PendingListView = ListView;
+	PendingListItem = Item;
+	PendingListIndex = Index;
+}
+
+int32 UUINavWidget::GetListIndexInDirection(const UListView* ListView, const int32 Index, const EUINavigation Direction) const
+{
+	if (Direction != EUINavigation::Up && Direction != EUINavigation::Down &&
+		Direction != EUINavigation::Left && Direction != EUINavigation::Right)
+	{
+		return INDEX_NONE;
+	}
+
+	const bool bVertical = ListView->GetOrientation() == EOrientation::Orient_Vertical;
+	int32 ItemsPerLine = 1;
+	if (const UTileView* TileView = Cast<UTileView>(ListView))
+	{
+		const FVector2D ListSize = ListView->GetCachedGeometry().GetLocalSize();
+		const float EntrySize = bVertical ? TileView->GetEntryWidth() : TileView->GetEntryHeight();
+		if (EntrySize > 0.0f)
+		{
+			ItemsPerLine = FMath::Max(1, FMath::FloorToInt((bVertical ? ListSize.X : ListSize.Y) / EntrySize));
+		}
+	}
+
+	const bool bForward = Direction == EUINavigation::Down || Direction == EUINavigation::Right;
+	const bool bAlongList = bVertical ?
+		Direction == EUINavigation::Up || Direction == EUINavigation::Down :
+		Direction == EUINavigation::Left || Direction == EUINavigation::Right;
+
+	int32 NewIndex;
+	if (bAlongList)
+	{
+		NewIndex = Index + (bForward ? ItemsPerLine : -ItemsPerLine);
+	}
+	else
+	{
+		// Moving across a line stops at its ends, letting Slate decide what happens next
+		const int32 IndexInLine = Index % ItemsPerLine;
+		if (bForward ? IndexInLine == ItemsPerLine - 1 : IndexInLine == 0)
+		{
+			return INDEX_NONE;
+		}
+		NewIndex = Index + (bForward ? 1 : -1);
+	}
+
+	return NewIndex >= 0 && NewIndex < ListView->GetNumItems() ? NewIndex : INDEX_NONE;
+}
+
+UUserWidget* UUINavWidget::GetListEntryWidget(UUINavComponent* Component) const
+{
+	UObject* Object = Component;
+	while (IsValid(Object) && Object != this)
+	{
+		UUserWidget* UserWidget = Cast<UUserWidget>(Object);
+		if (UserWidget != nullptr && UserWidget->Implements<UUserObjectListEntry>())
+		{
+			return UserWidget;
+		}
+		Object = Object->GetOuter();
+	}
+
+	return nullptr;
+}
+
+UUINavComponent* UUINavWidget::FindComponentInListEntry(UUserWidget* EntryWidget)
+{
+	if (UUINavComponent* EntryComponent = Cast<UUINavComponent>(EntryWidget))
+	{
+		return EntryComponent;
+	}
+
+	UUINavComponent* FoundComponent = nullptr;
+	if (IsValid(EntryWidget) && IsValid(EntryWidget->WidgetTree))
+	{
+		EntryWidget->WidgetTree->ForEachWidget([&FoundComponent](UWidget* Widget)
+		{
+			UUINavComponent* Component = Cast<UUINavComponent>(Widget);
+			if (FoundComponent == nullptr && Component != nullptr && Component->CanBeNavigated())
+			{
+				FoundComponent = Component;
+			}
+		});
+	}
+
+	return FoundComponent;
+}
+
+void UUINavWidget::OnListItemScrolledIntoView(UObject* Item, UUserWidget& EntryWidget)
+{
+	if (!PendingListItem.IsValid() || PendingListItem.Get() != Item)
+	{
+		return;
+	}
+
+	PendingListView.Reset();
+	PendingListItem.Reset();
+	PendingListIndex = INDEX_NONE;
+
+	if (UUINavComponent* EntryComponent = FindComponentInListEntry(&EntryWidget))
+	{
+		SetFocusOnComponent(EntryComponent);
+	}
+}
+
+void UUINavWidget::FlushSpatialIndex()
+{
+	for (auto It = DirtySpatialIndexComponents.CreateIterator(); It; ++It)
+	{
+		UUINavComponent* Component = It->Get();
+		if (!IsValid(Component))
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// Components that haven't been laid out yet stay dirty until they are
+		FBox2D Rect;
+		if (GetSpatialIndexRect(Component, Rect))
+		{
+			AddToSpatialIndex(Component, Rect);
+			It.RemoveCurrent();
+		}
+	}
+}
+
+FVector2D UUINavWidget::GetSpatialIndexScrollOffset(const UScrollBox* ScrollBox) const
+{
+	// Scroll boxes containing this whole widget move all of its components alike, so they're left out
+	FVector2D ScrollOffset = FVector2D::ZeroVector;
+	for (; IsValid(ScrollBox) && ScrollBox->IsIn(this); ScrollBox = Cast<UScrollBox>(UUINavBlueprintFunctionLibrary::GetParentPanelWidget(ScrollBox, UScrollBox::StaticClass())))
+	{
+		if (ScrollBox->GetOrientation() == Orient_Horizontal)
+		{
+			ScrollOffset.X += ScrollBox->GetScrollOffset();
+		}
+		else
+		{
+			ScrollOffset.Y += ScrollBox->GetScrollOffset();
+		}
+	}
+	return ScrollOffset;
+}
+
+void UUINavWidget::AddToSpatialIndex(UUINavComponent* Component, const FBox2D& Rect)
+{
+	UScrollBox* const ScrollBox = Component->GetParentScrollBox();
+	const TObjectKey<UScrollBox> ScrollBoxKey(IsValid(ScrollBox) && ScrollBox->IsIn(this) ? ScrollBox : nullptr);
+
+	TObjectKey<UScrollBox>& IndexedScrollBoxKey = SpatialIndexScrollBoxes.FindOrAdd(Component, ScrollBoxKey);
+	if (IndexedScrollBoxKey != ScrollBoxKey)
+	{
+		if (FUINavSpatialIndex* const OldIndex = SpatialIndices.Find(IndexedScrollBoxKey))
+		{
+			OldIndex->Remove(Component);
+		}
+		IndexedScrollBoxKey = ScrollBoxKey;
+	}
+
+	FUINavSpatialIndex* Index = SpatialIndices.Find(ScrollBoxKey);
+	if (Index == nullptr)
+	{
+		Index = &SpatialIndices.Add(ScrollBoxKey);
+		Index->Reset(SpatialIndexCellSize);
+	}
+
+	Index->Update(Component, Rect.ShiftBy(GetSpatialIndexScrollOffset(ScrollBoxKey.ResolveObjectPtr())));
+}
+
+void UUINavWidget::RemoveFromSpatialIndex(UUINavComponent* Component)
+{
+	TObjectKey<UScrollBox> ScrollBoxKey;
+	if (!SpatialIndexScrollBoxes.RemoveAndCopyValue(Component, ScrollBoxKey))
+	{
+		return;
+	}
+
+	if (FUINavSpatialIndex* const Index = SpatialIndices.Find(ScrollBoxKey))
+	{
+		Index->Remove(Component);
+	}
 }
 
 bool UUINavWidget::IsSelectorValid()
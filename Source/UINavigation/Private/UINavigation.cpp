@@ -1,19 +1,41 @@
 // Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
 
 #include "UINavigation.h"
+#include "UINavStats.h"
+#include "Data/UINavKeyClassification.h"
 #include "Modules/ModuleManager.h"
 
+#if UINAV_TRACE_ENABLED
+UE_TRACE_CHANNEL_DEFINE(UINavigationChannel);
+#endif
+
+DEFINE_STAT(STAT_UINavInitialSetup);
+DEFINE_STAT(STAT_UINavTraverseHierarchy);
+DEFINE_STAT(STAT_UINavRefreshNavigationKeys);
+DEFINE_STAT(STAT_UINavGetEnhancedInputKey);
+DEFINE_STAT(STAT_UINavUpdateInputVisuals);
+DEFINE_STAT(STAT_UINavGoToWidget);
+DEFINE_STAT(STAT_UINavCacheGameInputContexts);
+DEFINE_STAT(STAT_UINavHandleOnKeyDown);
+DEFINE_STAT(STAT_UINavWidgetsCreated);
+DEFINE_STAT(STAT_UINavInputIconsLoadedSynchronously);
+DEFINE_STAT(STAT_UINavNavigationConfigFullRebuilds);
+DEFINE_STAT(STAT_UINavNavigationConfigIncrementalRefreshes);
+DEFINE_STAT(STAT_UINavWidgetSetupLatencyFrames);
+
 #define LOCTEXT_NAMESPACE "FUINavigationModule"
 
 void FUINavigationModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	FUINavKeyClassification::Build();
 }
 
 void FUINavigationModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FUINavKeyClassification::Reset();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -4,6 +4,7 @@
 #include "UINavSettings.h"
 #include "Data/UINavEnhancedInputActions.h"
 #include "InputMappingContext.h"
+#include "PlayerMappableKeySettings.h"
 #include "UINavPCComponent.h"
 
 FUINavigationConfig::FUINavigationConfig(const UUINavPCComponent* const UINavPC, const bool bAllowDirectionalInput /*= true*/, const bool bAllowSectionInput /*= true*/, const bool bAllowAccept /*= true*/, const bool bAllowBack /*= true*/, const bool bUseAnalogDirectionalInput /*= true*/, const bool bUsingThumbstickAsMouse /*= false*/)
@@ -13,6 +14,100 @@ FUINavigationConfig::FUINavigationConfig(const UUINavPCComponent* const UINavPC,
 	bTabNavigation = false;
 	bKeyNavigation = true;
 	bAnalogNavigation = bUseAnalogDirectionalInput && !bUsingThumbstickAsMouse;
+	bThumbstickUsedAsMouse = bUsingThumbstickAsMouse;
+
+	TMap<FKey, EUINavigation> DirectionRules;
+	TMap<FKey, EUINavigationAction> ActionRules;
+	GatherRules(UINavPC, bAllowDirectionalInput, bAllowSectionInput, bAllowAccept, bAllowBack, bUsingThumbstickAsMouse, DirectionRules, ActionRules, GamepadSelectKeys);
+
+	for (const TPair<FKey, EUINavigation>& DirectionRule : DirectionRules)
+	{
+		AddDirectionRule(DirectionRule.Key, DirectionRule.Value);
+	}
+
+	for (const TPair<FKey, EUINavigationAction>& ActionRule : ActionRules)
+	{
+		AddActionRule(ActionRule.Key, ActionRule.Value);
+	}
+}
+
+bool FUINavigationConfig::Refresh(const UUINavPCComponent* const UINavPC, const bool bAllowDirectionalInput, const bool bAllowSectionInput, const bool bAllowAccept, const bool bAllowBack, const bool bUseAnalogDirectionalInput, const bool bUsingThumbstickAsMouse)
+{
+	TMap<FKey, EUINavigation> DirectionRules;
+	TMap<FKey, EUINavigationAction> ActionRules;
+	TArray<FKey> NewGamepadSelectKeys;
+	GatherRules(UINavPC, bAllowDirectionalInput, bAllowSectionInput, bAllowAccept, bAllowBack, bUsingThumbstickAsMouse, DirectionRules, ActionRules, NewGamepadSelectKeys);
+
+	bool bChanged = false;
+
+	const bool bNewAnalogNavigation = bUseAnalogDirectionalInput && !bUsingThumbstickAsMouse;
+	if (bAnalogNavigation != bNewAnalogNavigation || bThumbstickUsedAsMouse != bUsingThumbstickAsMouse)
+	{
+		bAnalogNavigation = bNewAnalogNavigation;
+		bThumbstickUsedAsMouse = bUsingThumbstickAsMouse;
+		bChanged = true;
+	}
+
+	TArray<FKey> RemovedKeys;
+	for (const TPair<FKey, EUINavigation>& DirectionRule : KeyEventRules)
+	{
+		if (!DirectionRules.Contains(DirectionRule.Key))
+		{
+			RemovedKeys.Add(DirectionRule.Key);
+		}
+	}
+	for (const FKey& RemovedKey : RemovedKeys)
+	{
+		RemoveDirectionRule(RemovedKey);
+		bChanged = true;
+	}
+
+	RemovedKeys.Reset();
+	for (const TPair<FKey, EUINavigationAction>& ActionRule : KeyActionRules)
+	{
+		if (!ActionRules.Contains(ActionRule.Key))
+		{
+			RemovedKeys.Add(ActionRule.Key);
+		}
+	}
+	for (const FKey& RemovedKey : RemovedKeys)
+	{
+		RemoveActionRule(RemovedKey);
+		bChanged = true;
+	}
+
+	for (const TPair<FKey, EUINavigation>& DirectionRule : DirectionRules)
+	{
+		const EUINavigation* const CurrentDirection = KeyEventRules.Find(DirectionRule.Key);
+		if (CurrentDirection == nullptr || *CurrentDirection != DirectionRule.Value)
+		{
+			AddDirectionRule(DirectionRule.Key, DirectionRule.Value);
+			bChanged = true;
+		}
+	}
+
+	for (const TPair<FKey, EUINavigationAction>& ActionRule : ActionRules)
+	{
+		const EUINavigationAction* const CurrentAction = KeyActionRules.Find(ActionRule.Key);
+		if (CurrentAction == nullptr || *CurrentAction != ActionRule.Value)
+		{
+			AddActionRule(ActionRule.Key, ActionRule.Value);
+			bChanged = true;
+		}
+	}
+
+	if (GamepadSelectKeys != NewGamepadSelectKeys)
+	{
+		GamepadSelectKeys = MoveTemp(NewGamepadSelectKeys);
+		bChanged = true;
+	}
+
+	return bChanged;
+}
+
+void FUINavigationConfig::GatherRules(const UUINavPCComponent* const UINavPC, const bool bAllowDirectionalInput, const bool bAllowSectionInput, const bool bAllowAccept, const bool bAllowBack, const bool bUsingThumbstickAsMouse,
+	TMap<FKey, EUINavigation>& OutDirectionRules, TMap<FKey, EUINavigationAction>& OutActionRules, TArray<FKey>& OutGamepadSelectKeys)
+{
 	const UInputMappingContext* const InputContext = UINavPC->GetUINavInputContext(UINavPC->GetActiveWidget());
 	const UUINavSettings* const UINavSettings = GetDefault<UUINavSettings>();
 	const UUINavEnhancedInputActions* const InputActions = UINavSettings->EnhancedInputActions.LoadSynchronous();
@@ -29,8 +124,8 @@ FUINavigationConfig::FUINavigationConfig(const UUINavPCComponent* const UINavPC,
 			{
 				continue;
 			}
-			FKey Key = UINavPC->GetCurrentKey(Mapping);
-			if (Pass == 1 && (ReservedKeys.Contains(Key) || Key == EKeys::LeftMouseButton || Key == EKeys::RightMouseButton || Key == EKeys::MouseScrollDown || Key == EKeys::MouseScrollUp)) {
+			const FKey Key = UINavPC->GetCurrentKey(Mapping);
+			if (Pass == 1 && (ReservedKeys.Contains(Key) || IsExcludedMappableKey(Key))) {
 				continue;
 			}
 			ReservedKeys.Add(Key);
@@ -38,19 +133,19 @@ FUINavigationConfig::FUINavigationConfig(const UUINavPCComponent* const UINavPC,
 			{
 				if (Mapping.Action == InputActions->IA_MenuUp)
 				{
-					KeyEventRules.Emplace(UINavPC->GetCurrentKey(Mapping), EUINavigation::Up);
+					OutDirectionRules.Emplace(Key, EUINavigation::Up);
 				}
 				else if (Mapping.Action == InputActions->IA_MenuDown)
 				{
-					KeyEventRules.Emplace(UINavPC->GetCurrentKey(Mapping), EUINavigation::Down);
+					OutDirectionRules.Emplace(Key, EUINavigation::Down);
 				}
 				else if (Mapping.Action == InputActions->IA_MenuLeft)
 				{
-					KeyEventRules.Emplace(UINavPC->GetCurrentKey(Mapping), EUINavigation::Left);
+					OutDirectionRules.Emplace(Key, EUINavigation::Left);
 				}
 				else if (Mapping.Action == InputActions->IA_MenuRight)
 				{
-					KeyEventRules.Emplace(UINavPC->GetCurrentKey(Mapping), EUINavigation::Right);
+					OutDirectionRules.Emplace(Key, EUINavigation::Right);
 				}
 			}
 			
@@ -58,30 +153,30 @@ FUINavigationConfig::FUINavigationConfig(const UUINavPCComponent* const UINavPC,
 			{
 				if (Mapping.Action == InputActions->IA_MenuNext)
 				{
-					KeyEventRules.Emplace(UINavPC->GetCurrentKey(Mapping), EUINavigation::Next);
+					OutDirectionRules.Emplace(Key, EUINavigation::Next);
 				}
 				else if (Mapping.Action == InputActions->IA_MenuPrevious)
 				{
-					KeyEventRules.Emplace(UINavPC->GetCurrentKey(Mapping), EUINavigation::Previous);
+					OutDirectionRules.Emplace(Key, EUINavigation::Previous);
 				}
 			}
 
 			if (bAllowAccept && Mapping.Action == InputActions->IA_MenuSelect)
 			{
-				const bool bIsGamepadKey = UINavPC->GetCurrentKey(Mapping).IsGamepadKey();
+				const bool bIsGamepadKey = Key.IsGamepadKey();
 				if (bIsGamepadKey)
 				{
-					GamepadSelectKeys.AddUnique(UINavPC->GetCurrentKey(Mapping));
+					OutGamepadSelectKeys.AddUnique(Key);
 				}
 
 				if (!bIsGamepadKey || !bUsingThumbstickAsMouse)
 				{
-					KeyActionRules.Emplace(UINavPC->GetCurrentKey(Mapping), EUINavigationAction::Accept);
+					OutActionRules.Emplace(Key, EUINavigationAction::Accept);
 				}
 			}
 			else if (bAllowBack && Mapping.Action == InputActions->IA_MenuReturn)
 			{
-				KeyActionRules.Emplace(UINavPC->GetCurrentKey(Mapping), EUINavigationAction::Back);
+				OutActionRules.Emplace(Key, EUINavigationAction::Back);
 			}
 		}
 	}
@@ -127,15 +222,148 @@ EUINavigation FUINavigationConfig::GetNavigationDirectionFromAnalogKey(const FKe
 	return EUINavigation::Invalid;
 }
 
-TArray<FKey> FUINavigationConfig::GetKeysForDirection(const EUINavigation Direction) const
+const TArray<FKey>& FUINavigationConfig::GetKeysForDirection(const EUINavigation Direction) const
+{
+	static const TArray<FKey> NoKeys;
+	const TArray<FKey>* const Keys = DirectionKeys.Find(Direction);
+	return Keys != nullptr ? *Keys : NoKeys;
+}
+
+const TArray<FKey>& FUINavigationConfig::GetKeysForAction(const EUINavigationAction Action) const
+{
+	static const TArray<FKey> NoKeys;
+	const TArray<FKey>* const Keys = ActionKeys.Find(Action);
+	return Keys != nullptr ? *Keys : NoKeys;
+}
+
+bool FUINavigationConfig::RebindKey(const UUINavPCComponent* const UINavPC, const FName PlayerMappableKeySettingsName, const FKey& OldKey, const FKey& NewKey)
 {
-	TArray<FKey> DirectionsKeys;
-	for (const TPair<FKey, EUINavigation>& KeyEventRule : KeyEventRules)
+	if (OldKey == NewKey)
+	{
+		return true;
+	}
+
+	const EUINavigation* const OldDirection = KeyEventRules.Find(OldKey);
+	const EUINavigationAction* const OldAction = KeyActionRules.Find(OldKey);
+	const bool bWasGamepadSelectKey = GamepadSelectKeys.Contains(OldKey);
+	//Without rules on the old key (unbound, excluded or reserved), there's nothing to tell which rules the new key should get
+	if (OldDirection == nullptr && OldAction == nullptr && !bWasGamepadSelectKey)
+	{
+		return false;
+	}
+
+	//Keys that are already in use, or that can't be used by player mappable mappings, need the config to be rebuilt
+	if (KeyEventRules.Contains(NewKey) || KeyActionRules.Contains(NewKey) || GamepadSelectKeys.Contains(NewKey) || IsExcludedMappableKey(NewKey))
 	{
-		if (KeyEventRule.Value == Direction)
+		return false;
+	}
+
+	//The old key's rules might still belong to another mapping, which only a rebuild can sort out
+	const UInputMappingContext* const InputContext = UINavPC != nullptr ? UINavPC->GetUINavInputContext(UINavPC->GetActiveWidget()) : nullptr;
+	if (InputContext == nullptr)
+	{
+		return false;
+	}
+
+	for (const FEnhancedActionKeyMapping& Mapping : InputContext->GetMappings())
+	{
+		const UPlayerMappableKeySettings* const KeySettings = Mapping.GetPlayerMappableKeySettings();
+		if (KeySettings != nullptr && KeySettings->Name == PlayerMappableKeySettingsName)
+		{
+			continue;
+		}
+
+		if (UINavPC->GetCurrentKey(Mapping) == OldKey)
+		{
+			return false;
+		}
+	}
+
+	const EUINavigation Direction = OldDirection != nullptr ? *OldDirection : EUINavigation::Invalid;
+	const EUINavigationAction Action = OldAction != nullptr ? *OldAction : EUINavigationAction::Invalid;
+	const bool bIsSelectKey = bWasGamepadSelectKey || Action == EUINavigationAction::Accept;
+
+	RemoveKeyRules(OldKey);
+
+	if (!NewKey.IsValid())
+	{
+		return true;
+	}
+
+	if (Direction != EUINavigation::Invalid)
+	{
+		AddDirectionRule(NewKey, Direction);
+	}
+
+	if (bIsSelectKey)
+	{
+		const bool bIsGamepadKey = NewKey.IsGamepadKey();
+		if (bIsGamepadKey)
+		{
+			GamepadSelectKeys.AddUnique(NewKey);
+		}
+
+		if (!bIsGamepadKey || !bThumbstickUsedAsMouse)
 		{
-			DirectionsKeys.Add(KeyEventRule.Key);
+			AddActionRule(NewKey, EUINavigationAction::Accept);
 		}
 	}
-	return DirectionsKeys;
+	else if (Action != EUINavigationAction::Invalid)
+	{
+		AddActionRule(NewKey, Action);
+	}
+
+	return true;
+}
+
+void FUINavigationConfig::AddDirectionRule(const FKey& Key, const EUINavigation Direction)
+{
+	if (const EUINavigation* const PreviousDirection = KeyEventRules.Find(Key))
+	{
+		DirectionKeys.FindOrAdd(*PreviousDirection).Remove(Key);
+	}
+
+	KeyEventRules.Emplace(Key, Direction);
+	DirectionKeys.FindOrAdd(Direction).AddUnique(Key);
+}
+
+void FUINavigationConfig::AddActionRule(const FKey& Key, const EUINavigationAction Action)
+{
+	if (const EUINavigationAction* const PreviousAction = KeyActionRules.Find(Key))
+	{
+		ActionKeys.FindOrAdd(*PreviousAction).Remove(Key);
+	}
+
+	KeyActionRules.Emplace(Key, Action);
+	ActionKeys.FindOrAdd(Action).AddUnique(Key);
+}
+
+void FUINavigationConfig::RemoveDirectionRule(const FKey& Key)
+{
+	EUINavigation Direction;
+	if (KeyEventRules.RemoveAndCopyValue(Key, Direction))
+	{
+		DirectionKeys.FindOrAdd(Direction).Remove(Key);
+	}
+}
+
+void FUINavigationConfig::RemoveActionRule(const FKey& Key)
+{
+	EUINavigationAction Action;
+	if (KeyActionRules.RemoveAndCopyValue(Key, Action))
+	{
+		ActionKeys.FindOrAdd(Action).Remove(Key);
+	}
+}
+
+void FUINavigationConfig::RemoveKeyRules(const FKey& Key)
+{
+	RemoveDirectionRule(Key);
+	RemoveActionRule(Key);
+	GamepadSelectKeys.Remove(Key);
+}
+
+bool FUINavigationConfig::IsExcludedMappableKey(const FKey& Key)
+{
+	return Key == EKeys::LeftMouseButton || Key == EKeys::RightMouseButton || Key == EKeys::MouseScrollDown || Key == EKeys::MouseScrollUp;
 }
@@ -41,4 +41,19 @@ public:
 	void ExecuteAction(UUINavComponent* Component);
 	virtual void ExecuteAction_Implementation(UUINavComponent* Component) {}
 
+	/*
+	*	Called after each execution of this action, to reset any state it changed so it can be executed again.
+	*	Not called if bFreshInstancePerExecution is true.
+	*/
+	UFUNCTION(BlueprintNativeEvent, Category = "UINavComponentAction")
+	void ResetAction();
+	virtual void ResetAction_Implementation() {}
+
+	/*
+	*	Whether to execute a new copy of this action every time, for actions that keep state they can't reset (such as latent actions still running).
+	*	Otherwise, the component's own instance of this action is executed and reset.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, AdvancedDisplay, Category = "UINavComponentAction")
+	bool bFreshInstancePerExecution = false;
+
 };
@@ -0,0 +1,39 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+#include "UObject/ObjectMacros.h"
+#include "InputLatencyStats.generated.h"
+
+USTRUCT(BlueprintType)
+struct FInputLatencyStats
+{
+	GENERATED_BODY()
+
+	FInputLatencyStats()
+	{
+
+	}
+
+	// The amount of samples the percentiles were computed from
+	UPROPERTY(BlueprintReadOnly, Category = InputLatencyStats)
+	int32 SampleCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = InputLatencyStats)
+	float P50Milliseconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = InputLatencyStats)
+	float P95Milliseconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = InputLatencyStats)
+	float P99Milliseconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = InputLatencyStats)
+	int32 P50Frames = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = InputLatencyStats)
+	int32 P95Frames = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = InputLatencyStats)
+	int32 P99Frames = 0;
+
+};
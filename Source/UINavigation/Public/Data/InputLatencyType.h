@@ -0,0 +1,11 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+#include "InputLatencyType.generated.h"
+
+UENUM(BlueprintType, meta = (ScriptName = "UINavInputLatencyType"))
+enum class EInputLatencyType : uint8
+{
+	Navigation UMETA(DisplayName = "Navigation"),
+	Select UMETA(DisplayName = "Select")
+};
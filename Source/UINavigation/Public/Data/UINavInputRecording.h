@@ -0,0 +1,108 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "InputCoreTypes.h"
+#include "Input/Events.h"
+#include "Misc/CoreMiscDefines.h"
+
+enum class EUINavRecordedInputType : uint8
+{
+	KeyDown,
+	KeyUp,
+	Analog,
+	MouseMove,
+	MouseButtonDown,
+	MouseButtonUp,
+	MouseButtonDoubleClick,
+	MouseWheel
+};
+
+/**
+* A single input event captured by the FUINavInputProcessor, with just enough data to rebuild the Slate event it came from
+*/
+struct UINAVIGATION_API FUINavRecordedInputEvent
+{
+	EUINavRecordedInputType Type = EUINavRecordedInputType::KeyDown;
+
+	// Seconds since the recording started
+	double Time = 0.0;
+
+	// Frames since the recording started, used to keep events that happened in the same frame together when replaying at maximum speed
+	uint32 Frame = 0;
+
+	int32 DeviceId = INDEX_NONE;
+	uint32 UserIndex = 0;
+	uint16 ModifierFlags = 0;
+	bool bIsRepeat = false;
+
+	// Index of the event's key (or the mouse button that caused it) in the recording's key table
+	int32 KeyIndex = INDEX_NONE;
+
+	// Analog value for analog events, wheel delta for mouse wheel events
+	float Value = 0.0f;
+
+	FVector2f ScreenPosition = FVector2f::ZeroVector;
+	FVector2f LastScreenPosition = FVector2f::ZeroVector;
+
+	// Indices of the mouse buttons held down during pointer events, in the recording's key table
+	TArray<int32> PressedButtonIndices;
+};
+
+/**
+* An ordered list of recorded input events, which can be saved to and loaded from a compact binary file.
+* Keys are stored once in a name table and referenced by index from each event.
+*/
+class UINAVIGATION_API FUINavInputRecording
+{
+public:
+
+	void Reset();
+
+	void AddKeyEvent(const EUINavRecordedInputType Type, const double Time, const uint32 Frame, const FKeyEvent& KeyEvent);
+
+	void AddAnalogEvent(const double Time, const uint32 Frame, const FAnalogInputEvent& AnalogEvent);
+
+	void AddPointerEvent(const EUINavRecordedInputType Type, const double Time, const uint32 Frame, const FPointerEvent& PointerEvent);
+
+	FKeyEvent MakeKeyEvent(const FUINavRecordedInputEvent& Event) const;
+
+	FAnalogInputEvent MakeAnalogEvent(const FUINavRecordedInputEvent& Event) const;
+
+	FPointerEvent MakePointerEvent(const FUINavRecordedInputEvent& Event) const;
+
+	/**
+	*	Writes the recording to the given file
+	*
+	*	@param	FilePath  The file to write to
+	*	@return  Whether the file was written
+	*/
+	bool SaveToFile(const FString& FilePath) const;
+
+	/**
+	*	Replaces this recording with the one in the given file
+	*
+	*	@param	FilePath  The file to read from
+	*	@return  Whether the file was a valid recording
+	*/
+	bool LoadFromFile(const FString& FilePath);
+
+	const TArray<FUINavRecordedInputEvent>& GetEvents() const { return Events; }
+
+	int32 Num() const { return Events.Num(); }
+
+protected:
+
+	int32 GetKeyIndex(const FKey& Key);
+
+	FKey GetKey(const int32 KeyIndex) const;
+
+	void Serialize(FArchive& Ar);
+
+	TArray<FUINavRecordedInputEvent> Events;
+
+	TArray<FName> KeyNames;
+
+	// KeyNames' indices, so each event doesn't have to search the table
+	TMap<FName, int32> KeyNameIndices;
+};
@@ -0,0 +1,53 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "InputCoreTypes.h"
+
+enum class EInputRestriction : uint8;
+
+/**
+* Caches what kind of device each key belongs to as a set of flags, so input restriction and VR category checks
+* don't have to look up key details or search the key's name every time.
+*/
+class UINAVIGATION_API FUINavKeyClassification
+{
+public:
+
+	enum EKeyFlags : uint16
+	{
+		Mouse = 1 << 0,
+		Gamepad = 1 << 1,
+		Oculus = 1 << 2,
+		Vive = 1 << 3,
+		MixedReality = 1 << 4,
+		Valve = 1 << 5,
+		PSMove = 1 << 6,
+
+		VR = Oculus | Vive | MixedReality | Valve | PSMove
+	};
+
+	/**
+	*	Classifies every key registered so far. Keys registered afterwards are classified the first time they're queried.
+	*/
+	static void Build();
+
+	static void Reset();
+
+	static uint16 GetKeyFlags(const FKey& Key);
+
+	/**
+	*	Returns the flag of the given key category, if it's one of the categories the table keeps track of
+	*
+	*	@param	Category  The category name, as searched for in key names
+	*	@return  The category's flag, or 0 if it isn't tracked
+	*/
+	static uint16 GetCategoryFlag(const FString& Category);
+
+	/**
+	*	Returns the flags of the keys belonging to the currently active XR system, checked again whenever that system changes
+	*/
+	static uint16 GetXRSystemFlags();
+
+	static bool RespectsRestriction(const FKey& Key, const EInputRestriction Restriction);
+};
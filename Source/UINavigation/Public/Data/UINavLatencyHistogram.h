@@ -0,0 +1,60 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "CoreGlobals.h"
+#include "HAL/PlatformTime.h"
+#include "Data/InputLatencyStats.h"
+
+/**
+* The moment an input that's expected to cause a focus change or a select arrived
+*/
+struct FUINavLatencySpan
+{
+	double StartTime = -1.0;
+	uint64 StartFrame = 0;
+
+	bool IsOpen() const { return StartTime >= 0.0; }
+
+	void Open()
+	{
+		StartTime = FPlatformTime::Seconds();
+		StartFrame = GFrameCounter;
+	}
+
+	void Close() { StartTime = -1.0; }
+};
+
+/**
+* Keeps the most recent input latency samples, in milliseconds and frames, and computes their percentiles on request
+*/
+class UINAVIGATION_API FUINavLatencyHistogram
+{
+public:
+
+	/**
+	*	Closes the given span and adds its duration as a sample, if it was open
+	*
+	*	@param	Span  The span to close
+	*/
+	void CloseSpan(FUINavLatencySpan& Span);
+
+	void AddSample(const float SampleMilliseconds, const int32 SampleFrames);
+
+	FInputLatencyStats GetStats() const;
+
+	void Reset();
+
+	int32 Num() const { return Milliseconds.Num(); }
+
+protected:
+
+	// Samples past this amount overwrite the oldest ones
+	static constexpr int32 MaxSamples = 1024;
+
+	TArray<float> Milliseconds;
+	TArray<int32> Frames;
+
+	// Where the next sample is written once the buffers are full
+	int32 NextSampleIndex = 0;
+};
@@ -0,0 +1,91 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "Math/Box2D.h"
+#include "Math/IntPoint.h"
+#include "Types/SlateEnums.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UUINavComponent;
+
+/**
+* Uniform grid over the layout rects of a UINavWidget's components, used to find the next component
+* in a given direction without going through Slate's focus search over the whole widget hierarchy.
+* Rects are expected to be in the owning widget's local space.
+*/
+class UINAVIGATION_API FUINavSpatialIndex
+{
+public:
+
+	/**
+	*	Removes all the components from the index and sets the size of its cells
+	*
+	*	@param	InCellSize  The width and height of each grid cell, in slate units
+	*/
+	void Reset(const float InCellSize);
+
+	/**
+	*	Adds the given component to the index, or moves it if it was already indexed
+	*
+	*	@param	Component  The component to add or move
+	*	@param	Rect  The component's rect
+	*/
+	void Update(UUINavComponent* Component, const FBox2D& Rect);
+
+	/**
+	*	Removes the given component from the index
+	*
+	*	@param	Component  The component to remove
+	*/
+	void Remove(UUINavComponent* Component);
+
+	/**
+	*	Returns the closest component in the given direction whose rect overlaps the source rect's perpendicular band,
+	*	mirroring Slate's own directional navigation rules. Only visits the grid cells between the source and the result.
+	*
+	*	@param	FromComponent  The component navigation starts from, which is ignored
+	*	@param	FromRect  The rect navigation starts from
+	*	@param	Direction  The direction to search in (Next and Previous aren't supported)
+	*	@param	Filter  Returns whether a candidate can be navigated to
+	*	@return  The found component, or nullptr if there's none in that direction
+	*/
+	UUINavComponent* FindNext(const UUINavComponent* FromComponent, const FBox2D& FromRect, const EUINavigation Direction, TFunctionRef<bool(UUINavComponent*)> Filter) const;
+
+	/**
+	*	Scores a candidate rect the way FindNext does, to compare results found in different indices
+	*
+	*	@param	FromRect  The rect navigation starts from
+	*	@param	CandidateRect  The rect of the candidate, in the same space as FromRect
+	*	@param	Direction  The direction to search in
+	*	@param	OutDistance  The candidate's distance from FromRect's leading edge
+	*	@param	OutOffset  The candidate's offset from the center of FromRect's perpendicular band
+	*	@return  Whether the candidate is in the given direction at all
+	*/
+	static bool GetNavigationScore(const FBox2D& FromRect, const FBox2D& CandidateRect, const EUINavigation Direction, double& OutDistance, double& OutOffset);
+
+	const FBox2D* GetRect(const UUINavComponent* Component) const;
+
+	void GetComponents(TArray<UUINavComponent*>& OutComponents) const;
+
+	int32 Num() const { return Rects.Num(); }
+
+protected:
+
+	FIntPoint GetCell(const FVector2D& Position) const;
+
+	void AddToCells(UUINavComponent* Component, const FBox2D& Rect);
+	void RemoveFromCells(UUINavComponent* Component, const FBox2D& Rect);
+
+	float CellSize = 128.0f;
+
+	TMap<TWeakObjectPtr<UUINavComponent>, FBox2D> Rects;
+	TMap<FIntPoint, TArray<TWeakObjectPtr<UUINavComponent>>> Cells;
+
+	// Components covering too many cells to be worth gridding, which are checked by every query
+	TArray<TWeakObjectPtr<UUINavComponent>> OversizedComponents;
+
+	// The range of cells that have ever been occupied since the last reset, which bounds the queries
+	FIntPoint MinCell = FIntPoint(MAX_int32, MAX_int32);
+	FIntPoint MaxCell = FIntPoint(MIN_int32, MIN_int32);
+};
@@ -0,0 +1,20 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+#include "UObject/ObjectMacros.h"
+#include "UINavWidgetPool.generated.h"
+
+class UUINavWidget;
+
+USTRUCT()
+struct FUINavWidgetPool
+{
+	GENERATED_BODY()
+
+	FUINavWidgetPool() {}
+
+	// Built widgets of a single class, waiting to be reused by GoToWidget
+	UPROPERTY()
+	TArray<UUINavWidget*> Widgets;
+
+};
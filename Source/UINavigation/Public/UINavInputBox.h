@@ -35,6 +35,9 @@ protected:
 	bool bAwaitingNewKey = false;
 	FKey AwaitingNewKey = FKey();
 
+	// Sets the current key, keeping the input container's key index up to date
+	void SetCurrentKey(const FKey& NewKey);
+
 	virtual void NativeOnMouseLeave(const FPointerEvent& InMouseEvent) override;
 	virtual void NativeOnFocusLost(const FFocusEvent& InFocusEvent) override;
 
@@ -63,9 +66,9 @@ public:
 	void CreateKeyWidgets();
 	bool TrySetupNewKey(const FKey& NewKey);
 	void ResetKeyWidgets();
-	void UpdateInputKey(const FKey& NewKey, const bool bSkipChecks = false);
-	void FinishUpdateNewKey();
-	void FinishUpdateNewEnhancedInputKey(const FKey& PressedKey);
+	bool UpdateInputKey(const FKey& NewKey, const bool bSkipChecks = false);
+	bool FinishUpdateNewKey();
+	bool FinishUpdateNewEnhancedInputKey(const FKey& PressedKey);
 	void CancelUpdateInputKey(const ERevertRebindReason Reason);
 	void RevertToKeyText();
 	ERevertRebindReason CanRegisterKey(class UUINavInputBox* InputBox, const FKey NewKey, int& OutCollidingActionIndex);
@@ -81,6 +84,12 @@ public:
 	UPROPERTY()
 	class UUINavPCComponent* UINavPC = nullptr;
 
+	// The input container this input box belongs to, and its index in that container's InputBoxes
+	UPROPERTY()
+	class UUINavInputContainer* InputContainer = nullptr;
+
+	int32 InputContainerIndex = INDEX_NONE;
+
 	UPROPERTY()
 	FName InputName;
 
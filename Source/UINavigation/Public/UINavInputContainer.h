@@ -14,6 +14,7 @@
 #include "UINavInputContainer.generated.h"
 
 class UPromptDataBase;
+class UUINavInputBox;
 class FReply;
 struct FGeometry;
 struct FFocusEvent;
@@ -34,6 +35,15 @@ protected:
 
 	class UUINavWidget* ParentWidget = nullptr;
 
+	// The indices of the input boxes currently using each key
+	TMap<FKey, TArray<int32, TInlineAllocator<2>>> KeyInputBoxes;
+
+	// KeyWhitelist and KeyBlacklist, hashed when the container is constructed
+	TSet<FKey> WhitelistedKeys;
+	TSet<FKey> BlacklistedKeys;
+
+	void RegisterInputBox(UUINavInputBox* InputBox);
+
 public:
 
 	virtual void NativeConstruct() override;
@@ -69,11 +79,40 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "UINav Input")
 	void ForceUpdateInputBoxes();
 
+	/**
+	*	Stages the following rebinds in memory, until they're committed or rolled back
+	*/
+	UFUNCTION(BlueprintCallable, Category = "UINav Input")
+	void BeginRebindTransaction();
+
+	/**
+	*	Applies the staged rebinds with a single mapping rebuild, and saves them to disk
+	*
+	*	@param	bSaveNow  Whether to save right away, instead of after the InputSettingsSaveDelay setting
+	*/
+	UFUNCTION(BlueprintCallable, Category = "UINav Input")
+	void CommitRebindTransaction(const bool bSaveNow = false);
+
+	/**
+	*	Reverts the staged rebinds and updates the input boxes
+	*/
+	UFUNCTION(BlueprintCallable, Category = "UINav Input")
+	void RollbackRebindTransaction();
+
 	ERevertRebindReason CanRegisterKey(class UUINavInputBox* InputBox, const FKey NewKey, int& OutCollidingActionIndex);
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "UINav Input")
 	bool CanUseKey(class UUINavInputBox* InputBox, const FKey CompareKey, int& OutCollidingActionIndex) const;
 
+	/**
+	*	Updates which input boxes are using each key, after the given input box's key changed
+	*
+	*	@param	InputBox  The input box whose key changed
+	*	@param	OldKey  The key the input box was using
+	*	@param	NewKey  The key the input box is now using
+	*/
+	void UpdateKeyIndex(const UUINavInputBox* InputBox, const FKey& OldKey, const FKey& NewKey);
+
 	UFUNCTION()
 	void OnInputTypeChanged(const EInputType InputType);
 
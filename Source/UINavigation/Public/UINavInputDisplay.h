@@ -35,6 +35,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "InputDisplay")
 	void UpdateInputVisuals();
 
+	// Queues this display to update its visuals on the next tick, batched with the other input displays
+	UFUNCTION(BlueprintCallable, Category = "InputDisplay")
+	void MarkVisualsDirty();
+
+	// Whether this display is constructed and visible, used to update it before the ones that aren't
+	bool IsOnScreen() const;
+
 	UFUNCTION(BlueprintCallable, Category = "InputDisplay")
 	void SetInputAction(UInputAction* NewAction, const EInputAxis NewAxis, const EAxisType NewScale);
 
@@ -50,6 +57,9 @@ public:
 	
 	FKey OverrideWithExactKey;
 
+	// Whether this display is waiting for its UINavPC to update its visuals
+	bool bVisualsDirty = false;
+
 public:
 
 	UPROPERTY(BlueprintReadWrite, meta = (BindWidget), Category = "InputDisplay")
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Framework/Application/IInputProcessor.h"
+#include "Data/UINavInputRecording.h"
 
 /**
 * 
@@ -13,6 +14,28 @@ class UINAVIGATION_API FUINavInputProcessor : public IInputProcessor
 protected:
 	class UUINavPCComponent* UINavPC = nullptr;
 
+	FUINavInputRecording Recording;
+	bool bRecording = false;
+	double RecordingStartTime = 0.0;
+	uint64 RecordingStartFrame = 0;
+
+	FUINavInputRecording Replay;
+	int32 ReplayEventIndex = INDEX_NONE;
+	double ReplayStartTime = 0.0;
+	bool bReplayAtMaxSpeed = false;
+
+	// Whether the event being handled was injected by the replay, as opposed to coming from an actual device
+	bool bDispatchingReplayEvent = false;
+
+	double GetRecordingTime() const { return FPlatformTime::Seconds() - RecordingStartTime; }
+	uint32 GetRecordingFrame() const { return static_cast<uint32>(GFrameCounter - RecordingStartFrame); }
+
+	// Live input is swallowed during a replay, so it can't make the replayed session diverge
+	bool ShouldBlockLiveInput() const { return IsReplaying() && !bDispatchingReplayEvent; }
+
+	void TickReplay(FSlateApplication& SlateApp);
+	void DispatchReplayEvent(FSlateApplication& SlateApp, const FUINavRecordedInputEvent& Event);
+
 public:
 
 	void SetUINavPC(UUINavPCComponent* NewUINavPC)
@@ -20,6 +43,34 @@ public:
 		UINavPC = NewUINavPC;
 	}
 	
+	/**
+	*	Starts recording every input event that reaches this processor, discarding any previous recording
+	*/
+	void StartRecording();
+
+	/**
+	*	Stops recording and saves the recorded events to the given file
+	*
+	*	@param	FilePath  The file to save the recording to
+	*	@return  Whether the recording was saved
+	*/
+	bool StopRecording(const FString& FilePath);
+
+	bool IsRecording() const { return bRecording; }
+
+	/**
+	*	Starts feeding the events recorded in the given file back through Slate, blocking live input until it ends
+	*
+	*	@param	FilePath  The recording to replay
+	*	@param	bAtMaxSpeed  Whether to replay one recorded frame per frame, instead of following the recorded timestamps
+	*	@return  Whether the recording was loaded
+	*/
+	bool StartReplay(const FString& FilePath, const bool bAtMaxSpeed);
+
+	void StopReplay();
+
+	bool IsReplaying() const { return ReplayEventIndex != INDEX_NONE; }
+
 	virtual void Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor) override;
 
 	virtual bool HandleKeyDownEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent) override;
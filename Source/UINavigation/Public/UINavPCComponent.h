@@ -22,21 +22,33 @@
 #include "Delegates/DelegateCombinations.h"
 #include "Misc/CoreMiscDefines.h"
 #include "UObject/SoftObjectPtr.h"
+#include "UObject/ObjectKey.h"
 #include "Data/PromptData.h"
+#include "Data/UINavWidgetPool.h"
+#include "Data/InputIconMapping.h"
+#include "Data/InputLatencyType.h"
+#include "Data/UINavLatencyHistogram.h"
 #include "UINavPCComponent.generated.h"
 
 class APlayerController;
 class FUINavInputProcessor;
+class FUINavigationConfig;
 class UUINavInputBox;
+class UUINavInputDisplay;
 class UTexture2D;
 class UUINavWidget;
 class UUINavPromptWidget;
 class UInputMappingContext;
+class UEnhancedInputUserSettings;
 class UCurveFloat;
+class UFont;
 class FText;
+struct FStreamableHandle;
+struct FGameplayTagContainer;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInputTypeChangedDelegate, EInputType, InputType);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FUpdateInputIconsDelegate);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FGameInputContextsReadyDelegate);
 
 USTRUCT(BlueprintType)
 struct FAxis2D_Keys
@@ -60,6 +72,48 @@ public:
 	FKey NegativeKey;
 };
 
+struct FUINavInputKeyQuery
+{
+	FUINavInputKeyQuery(const UInputAction* InAction, const EInputAxis InAxis, const EAxisType InScale, const EInputRestriction InInputRestriction) :
+		Action(InAction),
+		Axis(InAxis),
+		Scale(InScale),
+		InputRestriction(InInputRestriction)
+	{
+	}
+
+	bool operator==(const FUINavInputKeyQuery& Other) const
+	{
+		return Action == Other.Action && Axis == Other.Axis && Scale == Other.Scale && InputRestriction == Other.InputRestriction;
+	}
+
+	friend uint32 GetTypeHash(const FUINavInputKeyQuery& Query)
+	{
+		uint32 Hash = GetTypeHash(Query.Action);
+		Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Query.Axis)));
+		Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Query.Scale)));
+		return HashCombine(Hash, GetTypeHash(static_cast<uint8>(Query.InputRestriction)));
+	}
+
+	TObjectKey<UInputAction> Action;
+	EInputAxis Axis;
+	EAxisType Scale;
+	EInputRestriction InputRestriction;
+};
+
+struct FUINavKeyIconLoad
+{
+	TSharedPtr<FStreamableHandle> Handle;
+	TArray<FSimpleDelegate> OnLoadedCallbacks;
+};
+
+struct FUINavStagedRebind
+{
+	FName PlayerMappableKeySettingsName;
+	FKey PreviousKey;
+	FKey NewKey;
+};
+
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class UINAVIGATION_API UUINavPCComponent : public UActorComponent
 {
@@ -95,6 +149,9 @@ protected:
 
 	TSharedPtr<FUINavInputProcessor> SharedInputProcessor = nullptr;
 
+	// The navigation config last given to Slate by this component, refreshed in place when possible
+	TSharedPtr<FUINavigationConfig> NavigationConfig = nullptr;
+
 	FVector2D ThumbstickDelta = FVector2D::ZeroVector;
 
 	ECountdownPhase CountdownPhase = ECountdownPhase::None;
@@ -116,13 +173,30 @@ protected:
 	UPROPERTY()
 	TArray<const UInputMappingContext*> CachedInputContexts;
 
+	TSharedPtr<FStreamableHandle> GameInputContextsHandle;
+
+	bool bGameInputContextsReady = false;
+
+	// Opened by navigation and select key presses, and closed once the focus change or select they caused happens
+	FUINavLatencySpan NavigationLatencySpan;
+	FUINavLatencySpan SelectLatencySpan;
+	FKey NavigationLatencyKey;
+
+	FUINavLatencyHistogram NavigationLatency;
+	FUINavLatencyHistogram SelectLatency;
+
+	void OpenInputLatencySpans(const FKeyEvent& KeyEvent);
+
 	UPROPERTY()
 	TMap<const UInputMappingContext*, uint8> AddedInputContexts;
 
 	UPROPERTY()
 	UInputMappingContext* CurrentInputContext = nullptr;
 
-	TArray<int32> InputActionBindingHandles;
+	TArray<int32> DirectionalInputBindingHandles;
+	TArray<int32> SelectInputBindingHandles;
+	TArray<int32> ReturnInputBindingHandles;
+	TArray<int32> SectionInputBindingHandles;
 
 	TMap<EUINavigation, TArray<FKey>> PressedNavigationDirections;
 
@@ -182,16 +256,88 @@ protected:
 
 	TArray<FKey> GamepadSelectKeys;
 
+	UPROPERTY()
+	TMap<TSubclassOf<UUINavWidget>, FUINavWidgetPool> WidgetPools;
+
+	// Keys found by GetEnhancedInputKey, GetEnhancedInputKeys and GetEnhancedInputMappableKey, cleared whenever the mappings change
+	mutable TMap<FUINavInputKeyQuery, FKey> InputKeyCache;
+	TMap<TObjectKey<UInputAction>, TArray<FKey>> InputKeysCache;
+	mutable TMap<FName, FKey> MappableKeyCache;
+
+	// The rows of the current key icon and name tables, flattened by key and rebuilt whenever the tables change
+	mutable TMap<FKey, FInputIconMapping> KeyIconMappings;
+	mutable TMap<FKey, FText> KeyNames;
+	mutable bool bKeyDataDirty = true;
+
+	// Key icon textures and fonts kept loaded, from least to most recently used
+	UPROPERTY()
+	TArray<UObject*> ResidentKeyIconAssets;
+
+	// The resource size of each asset in ResidentKeyIconAssets, at the same index
+	TArray<int64> ResidentKeyIconAssetSizes;
+	int64 ResidentKeyIconBytes = 0;
+
+	TMap<FSoftObjectPath, FUINavKeyIconLoad> PendingKeyIconLoads;
+	TSet<FSoftObjectPath> FailedKeyIconAssets;
+
+	// The constructed input displays, and the ones waiting to update their visuals on the next tick
+	TArray<TWeakObjectPtr<UUINavInputDisplay>> InputDisplays;
+	TArray<TWeakObjectPtr<UUINavInputDisplay>> DirtyInputDisplays;
+
+	// The player mappable key changes made since the outermost BeginRebindTransaction, in the order they were made
+	TArray<FUINavStagedRebind> StagedRebinds;
+
+	// The amount of staged rebinds when each open transaction began, so rolling one back only reverts its own rebinds
+	TArray<int32> RebindTransactionSavepoints;
+
+	// Whether a pending mappings rebuild was requested after the navigation config was already updated by a rebind
+	bool bRebuildRequestedAfterRebind = false;
+
+	// Whether a pending mappings rebuild was requested for any other reason, which needs the navigation keys to be refreshed
+	bool bRebuildRequestedWithStaleNavigationKeys = false;
+
+	// Time left until the input settings are saved to disk, or negative if there's nothing to save
+	float InputSettingsSaveCountdown = -1.0f;
+
 	/*************************************************************************/
 
 	void SetTimer(const EUINavigation NavigationDirection);
 
 	void CacheGameInputContexts();
 
+	void OnGameInputContextsLoaded(TArray<FSoftObjectPath> ContextPaths);
+
+	FKey FindEnhancedInputKey(const UInputAction* Action, const EInputAxis Axis, const EAxisType Scale, const EInputRestriction InputRestriction) const;
+
+	void FindEnhancedInputKeys(const UInputAction* Action, TArray<FKey>& OutKeys);
+
+	FKey FindEnhancedInputMappableKey(const FName PlayerMappableKeySettingsName) const;
+
 	void TryResetDefaultInputs();
 
 	void InitPlatformData();
 
+	void RebuildKeyData() const;
+
+	void MarkKeyDataDirty();
+
+	UObject* RequestKeyIconAsset(const FSoftObjectPath& AssetPath, const bool bHighPriority, const FSimpleDelegate& OnLoaded);
+
+	void OnKeyIconAssetLoaded(FSoftObjectPath AssetPath);
+
+	void MakeKeyIconAssetResident(UObject* Asset);
+
+	void UpdateDirtyInputDisplays();
+
+	// Whether there's anything left for TickComponent to do, otherwise the component stops ticking until RequestTick is called
+	bool NeedsTick() const;
+
+	void UpdateUsingThumbstickAsMouse();
+
+	UEnhancedInputUserSettings* GetInputUserSettings() const;
+
+	void ScheduleSaveInputSettings();
+
 	void ClearNavigationTimer();
 
 	/**
@@ -223,6 +369,8 @@ protected:
 
 	void BindNavigationInputs();
 	void UnbindNavigationInputs();
+	void UnbindNavigationInputs(TArray<int32>& BindingHandles);
+	void CacheGamepadSelectKeys();
 
 	void MenuUpStarted();
 	void MenuUpStopped();
@@ -279,7 +427,7 @@ public:
 	Indicates whether the controller should use the left or right stick as mouse.
 	If the active UINavWidget has this set to a value different than None, it will override this one.
 	*/
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = UINavController)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetUseThumbstickAsMouse, Category = UINavController)
 	EThumbstickAsMouse UseThumbstickAsMouse = EThumbstickAsMouse::None;
 
 	/*
@@ -373,6 +521,13 @@ public:
 	UPROPERTY(BlueprintAssignable, BlueprintCallable, BlueprintReadOnly, Category = UINavController)
 	FUpdateInputIconsDelegate UpdateInputIconsDelegate;
 
+	//Called once the game's Input Mapping Contexts have been loaded and can be used to find input keys
+	UPROPERTY(BlueprintAssignable, BlueprintCallable, BlueprintReadOnly, Category = UINavController)
+	FGameInputContextsReadyDelegate GameInputContextsReadyDelegate;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavController)
+	FORCEINLINE bool AreGameInputContextsReady() const { return bGameInputContextsReady; }
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavController)
 	FORCEINLINE bool AllowsAllMenuInput() const { return bAllowDirectionalInput && bAllowSelectInput && bAllowReturnInput && bAllowSectionInput; }
 
@@ -392,6 +547,12 @@ public:
 	
 	EThumbstickAsMouse UsingThumbstickAsMouse() const;
 
+	/**
+	*	Sets which thumbstick moves the mouse and applies it right away, even while this component isn't ticking
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintSetter, Category = UINavController)
+	void SetUseThumbstickAsMouse(const EThumbstickAsMouse NewUseThumbstickAsMouse);
+
 	UFUNCTION(BlueprintCallable, Category = UINavController)
 	void SetShowMouseCursor(const bool bShowMouse);
 
@@ -403,6 +564,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = UINavController)
 	void RefreshNavigationKeys();
 
+	/**
+	*	Updates the navigation config after a player mappable key was rebound, without rebuilding it
+	*
+	*	@param	PlayerMappableKeySettingsName  The name of the rebound player mappable key settings
+	*	@param	OldKey  The key that was replaced
+	*	@param	NewKey  The key that replaces it
+	*/
+	void ApplyNavigationKeyRebind(const FName PlayerMappableKeySettingsName, const FKey& OldKey, const FKey& NewKey);
+
 	UFUNCTION(BlueprintCallable, Category = UINavController)
 	void SetAllowAllMenuInput(const bool bAllowInput);
 
@@ -428,17 +598,151 @@ public:
 	void InputKey(const FKey& Key, const EInputEvent Event, const float Delta);
 
 	/*
-	*	Fetches all UINavInputDisplays and forces them to update their visuals.
+	*	Marks all UINavInputDisplays as needing to update their visuals, which they'll do on the next tick.
 	* 
 	*	@param bOnlyTopLevel Whether to update only direct children of the viewport.
 	*/
 	UFUNCTION(BlueprintCallable, Category = UINavController)
 	void ForceUpdateAllInputDisplays(const bool bOnlyTopLevel = false);
 
-	void SetIgnoreFocusByNavigation(const bool bIgnore) { bIgnoreFocusByNavigation = bIgnore; }
+	void RegisterInputDisplay(UUINavInputDisplay* InputDisplay);
+	void UnregisterInputDisplay(UUINavInputDisplay* InputDisplay);
+
+	/**
+	*	Queues the given input display to update its visuals on the next tick, along with any other dirty displays
+	*
+	*	@param	InputDisplay  The input display to update
+	*/
+	void MarkInputDisplayDirty(UUINavInputDisplay* InputDisplay);
+
+	/**
+	*	Enables ticking until this component is idle again
+	*/
+	void RequestTick();
+
+	void SetIgnoreFocusByNavigation(const bool bIgnore)
+	{
+		bIgnoreFocusByNavigation = bIgnore;
+		if (bIgnore)
+		{
+			RequestTick();
+		}
+	}
 	bool IgnoreFocusByNavigation() const { return bIgnoreFocusByNavigation; }
 
-	void RequestRebuildMappings();
+	/**
+	*	Requests the control mappings of every enhanced input subsystem to be rebuilt
+	*
+	*	@param	bNavigationKeysUpToDate  Whether the navigation keys were already updated, so OnControlMappingsRebuilt doesn't need to refresh them
+	*/
+	void RequestRebuildMappings(const bool bNavigationKeysUpToDate = false);
+
+	/**
+	*	Maps a new key to the first slot of the given player mappable key settings.
+	*	Inside a rebind transaction the change is only staged, otherwise it's applied right away and saved after InputSettingsSaveDelay.
+	*
+	*	@param	PlayerMappableKeySettingsName  The name of the player mappable key settings to rebind
+	*	@param	NewKey  The key to map
+	*	@param	OutFailureReason  Why the key couldn't be mapped, if it failed
+	*	@return Whether the key was mapped
+	*/
+	bool RemapPlayerKey(const FName PlayerMappableKeySettingsName, const FKey& NewKey, FGameplayTagContainer& OutFailureReason);
+
+	/**
+	*	Starts staging rebinds in memory, until the matching CommitRebindTransaction or RollbackRebindTransaction. Transactions can be nested.
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavController)
+	void BeginRebindTransaction();
+
+	/**
+	*	Closes a rebind transaction. Once the outermost transaction is committed, its rebinds are applied with a single mapping rebuild.
+	*
+	*	@param	bSaveNow  Whether to save the input settings to disk right away, instead of after InputSettingsSaveDelay
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavController)
+	void CommitRebindTransaction(const bool bSaveNow = false);
+
+	/**
+	*	Reverts the rebinds staged since the matching BeginRebindTransaction, and closes that transaction.
+	*	Rebinds staged by outer transactions are kept.
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavController)
+	void RollbackRebindTransaction();
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavController)
+	bool IsInRebindTransaction() const { return RebindTransactionSavepoints.Num() > 0; }
+
+	/**
+	*	Resets the player's key mappings to their defaults, discarding any open rebind transactions
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavController)
+	void ResetInputSettings();
+
+	/**
+	*	Saves the input settings to disk right away, if there are unsaved rebinds
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavController)
+	void SaveInputSettings();
+
+	/**
+	*	Clears the cached keys of input actions, so that they're searched again the next time they're requested
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavController)
+	void InvalidateInputKeyCache();
+
+	/**
+	*	Starts recording every key, analog, mouse and wheel event that reaches UINav, with timestamps and device IDs
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavController)
+	void StartInputRecording();
+
+	/**
+	*	Stops recording input and saves it to a binary file
+	*
+	*	@param	FilePath  The file to save to. Relative paths are placed in Saved/UINavInputRecordings
+	*	@return Whether the recording was saved
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavController)
+	bool StopInputRecording(const FString& FilePath);
+
+	/**
+	*	Feeds a recorded input file back through Slate, ignoring live input until the replay ends
+	*
+	*	@param	FilePath  The file to replay. Relative paths are searched for in Saved/UINavInputRecordings
+	*	@param	bAtMaxSpeed  Whether to replay one recorded frame per frame, instead of following the recorded timestamps
+	*	@return Whether the replay started
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavController)
+	bool StartInputReplay(const FString& FilePath, const bool bAtMaxSpeed = false);
+
+	UFUNCTION(BlueprintCallable, Category = UINavController)
+	void StopInputReplay();
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavController)
+	bool IsRecordingInput() const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavController)
+	bool IsReplayingInput() const;
+
+	/**
+	*	Adds a latency sample if an input of the given type is waiting for its result
+	*
+	*	@param	LatencyType  Whether a focus change or a select just happened
+	*/
+	void CloseInputLatencySpan(const EInputLatencyType LatencyType);
+
+	/**
+	*	Returns the percentiles of the time (in milliseconds and frames) between navigation key presses and the resulting focus changes,
+	*	or between select key presses and the resulting selects, over the most recent samples
+	*
+	*	@param	LatencyType  The kind of input to get the latency of
+	*	@return The latency percentiles
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavController)
+	FInputLatencyStats GetInputLatencyStats(const EInputLatencyType LatencyType) const;
+
+	UFUNCTION(BlueprintCallable, Category = UINavController)
+	void ResetInputLatencyStats();
 
 	void AddInputContextFromUINavWidget(UUINavWidget* UINavWidget, const UUINavWidget* const ParentLimit = nullptr);
 	void RemoveInputContextFromUINavWidget(UUINavWidget* UINavWidget, const UUINavWidget* const ParentLimit = nullptr);
@@ -542,6 +846,33 @@ public:
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavController)
 	FInputIconMapping GetKeyIconMapping(const FKey Key) const;
+
+	/**
+	*	Returns the icon texture of the given key if it's loaded, otherwise starts streaming it in without blocking and returns nullptr
+	*
+	*	@param	Key  The key whose icon to get
+	*	@param	bHighPriority  Whether the icon is needed on screen right away
+	*	@param	OnLoaded  Called once the icon finishes streaming in, if it wasn't loaded yet
+	*/
+	UTexture2D* RequestKeyIcon(const FKey Key, const bool bHighPriority, const FSimpleDelegate& OnLoaded = FSimpleDelegate());
+
+	/**
+	*	Returns the icon font of the given key if it's loaded, otherwise starts streaming it in without blocking and returns nullptr
+	*
+	*	@param	Key  The key whose icon font to get
+	*	@param	bHighPriority  Whether the font is needed on screen right away
+	*	@param	OnLoaded  Called once the font finishes streaming in, if it wasn't loaded yet
+	*/
+	UFont* RequestKeyIconFont(const FKey Key, const bool bHighPriority, const FSimpleDelegate& OnLoaded = FSimpleDelegate());
+
+	// Whether the given key icon texture or font is currently being streamed in
+	bool IsKeyIconAssetLoading(const FSoftObjectPath& AssetPath) const { return PendingKeyIconLoads.Contains(AssetPath); }
+
+	/**
+	*	Stops keeping the streamed key icon textures and fonts loaded, so they can be garbage collected
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavController)
+	void ClearResidentKeyIcons();
 	
 	//Get first found Icon associated with the given enhanced input action
 	//Will search the icon table
@@ -613,6 +944,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category = UINavController, meta = (AdvancedDisplay = 2, DeterminesOutputType = "NewWidgetClass"))
 	UUINavWidget* GoToBuiltWidget(UUINavWidget* NewWidget, const bool bRemoveParent, const bool bDestroyParent = false, const int ZOrder = 0);
 
+	/**
+	*	Returns a pooled widget of the given class, or creates a new one if none is available
+	*
+	*	@param	WidgetClass  The class of the widget to get
+	*/
+	UUINavWidget* AcquirePooledWidget(TSubclassOf<UUINavWidget> WidgetClass);
+
+	/**
+	*	Resets the given widget and stores it to be reused by GoToWidget.
+	*	Only widgets acquired through AcquirePooledWidget are pooled.
+	*
+	*	@param	Widget  The widget that was removed from the screen
+	*	@return Whether the widget was added to the pool
+	*/
+	bool ReleasePooledWidget(UUINavWidget* Widget);
+
+	/**
+	*	Removes all the widgets kept in the widget pool
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavController)
+	void ClearWidgetPool();
+
 	UFUNCTION(BlueprintCallable, Category = UINavController, meta = (AdvancedDisplay = 1))
 	void NavigateInDirection(const EUINavigation Direction, const int32 UserIndex = 0);
 	void MenuNext();
@@ -6,6 +6,7 @@
 #include "UINavSectionButton.generated.h"
 
 class UButton;
+class UUINavWidget;
 
 /**
  * 
@@ -21,4 +22,26 @@ public:
 	UButton* SectionButton = nullptr;
 
 };
+
+/**
+ * Forwards a section button's OnClicked event to its UINavWidget along with the section's index
+ */
+UCLASS()
+class UINAVIGATION_API UUINavSectionButtonBinding : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	void Bind(UButton* Button, UUINavWidget* Widget, const int32 Index);
+
+	UFUNCTION()
+	void OnClicked();
+
+	UPROPERTY()
+	UUINavWidget* OwningWidget = nullptr;
+
+	int32 SectionIndex = INDEX_NONE;
+
+};
  
@@ -9,6 +9,7 @@
 #include "Data/PlatformConfigData.h"
 #include "Data/SelectorPosition.h"
 #include "Math/MathFwd.h"
+#include "Engine/EngineTypes.h"
 #include "UINavSettings.generated.h"
 
 /**
@@ -79,6 +80,24 @@ public:
 	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	bool bLoadInputIconsAsync = false;
 
+	/*
+	* The maximum memory (in kilobytes) used by the asynchronously loaded input icon textures and fonts kept loaded, after which the least recently used ones are released.
+	* The most recently used icon is always kept, even if it exceeds this budget on its own. Set to 0 to not keep any icon loaded.
+	*/
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings", meta = (ClampMin = 0, EditCondition = "bLoadInputIconsAsync"))
+	int32 ResidentInputIconsBudgetKB = 8192;
+
+	/*
+	* The maximum time (in milliseconds) spent updating input displays each frame after the input type or the input icons change.
+	* Displays on screen are updated first, and at least one display is updated per frame. Set to 0 to update all of them in the same frame.
+	*/
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings", meta = (ClampMin = 0))
+	float InputDisplayUpdateBudget = 0.0f;
+
+	// How long (in seconds) to wait after a rebind before saving the input settings to disk, so several rebinds in a row are only saved once. Set to 0 to save right away
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings", meta = (ClampMin = 0))
+	float InputSettingsSaveDelay = 1.0f;
+
 	// The amount of mouse movement delta that will trigger a rebind attempt when listening to a new key for input rebinding
 	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	float MouseMoveRebindThreshold = 2.0f;
@@ -114,6 +133,28 @@ public:
 		TEXT("SMultilineEditableText")
 	};
 
+	/*
+	* Whether to load the project's Input Mapping Contexts (used to find the keys of non-UINav input actions) asynchronously through the Asset Manager,
+	* instead of loading them all synchronously when the UINavPC begins play. Key queries made before they're loaded only use the active input contexts.
+	*/
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	bool bLoadGameInputContextsAsync = false;
+
+	// If not empty, only Input Mapping Contexts inside these paths (and their subfolders) will be loaded by the UINavPC
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings", meta = (LongPackageName))
+	TArray<FDirectoryPath> GameInputContextPaths;
+
+	// If not empty, only Input Mapping Contexts with at least one of these asset registry tags will be loaded by the UINavPC
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	TArray<FName> GameInputContextTags;
+
+	/*
+	* The maximum amount of UINavWidgets of each class that the UINavPC keeps around to be reused by GoToWidget, after they're returned from.
+	* Pooled widgets keep their widget tree and UINav setup, so their Construct event runs again when reused. Set to 0 to disable pooling.
+	*/
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings", meta = (ClampMin = 0))
+	int32 WidgetPoolCapacity = 0;
+
 	// Increment by 1 everytime your project's default inputs change
 	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	uint8 CurrentInputVersion = 0;
@@ -127,4 +168,23 @@ public:
 
 	UPROPERTY(config, EditAnywhere, Category = "Settings")
 	TSoftObjectPtr<UUINavEnhancedInputActions> EnhancedInputActions = TSoftObjectPtr<UUINavEnhancedInputActions>(FSoftObjectPath("/UINavigation/Input/UINavEnhancedInputActions.UINavEnhancedInputActions"));
+
+	virtual void PostInitProperties() override;
+	virtual void PostReloadConfig(FProperty* PropertyThatWasLoaded) override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	/**
+	*	Rebuilds the set of widget type names allowed to be focused from AllowedWidgetTypesToFocus.
+	*	Should be called after changing AllowedWidgetTypesToFocus at runtime.
+	*/
+	void RebuildAllowedWidgetTypesToFocus();
+
+	bool IsWidgetTypeAllowedToFocus(const FName WidgetType) const { return AllowedWidgetTypeNamesToFocus.Contains(WidgetType); }
+
+protected:
+
+	// AllowedWidgetTypesToFocus as names, so focus changes can be filtered without building or comparing strings
+	TSet<FName> AllowedWidgetTypeNamesToFocus;
 };
@@ -0,0 +1,35 @@
+// Copyright (C) 2023 Gonçalo Marques - All Rights Reserved
+
+#pragma once
+
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+// Whether UINav's hot paths emit events on their own Unreal Insights trace channel (enable it with -trace=cpu,UINavigation)
+#define UINAV_TRACE_ENABLED (CPUPROFILERTRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+#if UINAV_TRACE_ENABLED
+UE_TRACE_CHANNEL_EXTERN(UINavigationChannel, UINAVIGATION_API);
+#define UINAV_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(#Stat, UINavigationChannel)
+#else
+#define UINAV_SCOPE_CYCLE_COUNTER(Stat) SCOPE_CYCLE_COUNTER(Stat)
+#endif
+
+DECLARE_STATS_GROUP(TEXT("UINavigation"), STATGROUP_UINavigation, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Widget Initial Setup"), STAT_UINavInitialSetup, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Traverse Hierarchy"), STAT_UINavTraverseHierarchy, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Refresh Navigation Keys"), STAT_UINavRefreshNavigationKeys, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Get Enhanced Input Key"), STAT_UINavGetEnhancedInputKey, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update Input Visuals"), STAT_UINavUpdateInputVisuals, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Go To Widget"), STAT_UINavGoToWidget, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cache Game Input Contexts"), STAT_UINavCacheGameInputContexts, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Handle Key Down"), STAT_UINavHandleOnKeyDown, STATGROUP_UINavigation, UINAVIGATION_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Widgets Created"), STAT_UINavWidgetsCreated, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Input Icons Loaded Synchronously"), STAT_UINavInputIconsLoadedSynchronously, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Navigation Config Full Rebuilds"), STAT_UINavNavigationConfigFullRebuilds, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Navigation Config Incremental Refreshes"), STAT_UINavNavigationConfigIncrementalRefreshes, STATGROUP_UINavigation, UINAVIGATION_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Last Widget Setup Latency (Frames)"), STAT_UINavWidgetSetupLatencyFrames, STATGROUP_UINavigation, UINAVIGATION_API);
@@ -10,6 +10,7 @@
 #include "Data/ThumbstickAsMouse.h"
 #include "UObject/Object.h"
 #include "Data/PromptData.h"
+#include "Data/UINavSpatialIndex.h"
 #include "Templates/SharedPointer.h"
 #include "Widgets/SWidget.h"
 #include "Slate/SObjectWidget.h"
@@ -22,6 +23,9 @@ class UPromptDataBase;
 class UScrollBox;
 class UInputMappingContext;
 class UWidgetSwitcher;
+class UListView;
+class USizeBox;
+class UUINavSectionButtonBinding;
 class UButton;
 enum class EButtonStyle : uint8;
 enum class EUINavigation : uint8;
@@ -46,8 +50,14 @@ protected:
 	UPROPERTY()
 	UUINavComponent* UpdateSelectorNextComponent = nullptr;
 	
-	int8 UINavSetupWaitForTick = -1;
-	int8 UpdateSelectorWaitForTick = -1;
+	// Setup and selector updates waiting for this widget to be laid out, handled after Slate's next tick
+	bool bPendingUINavSetup = false;
+	bool bPendingSelectorUpdate = false;
+	FDelegateHandle LayoutReadyHandle;
+
+	// The frame in which the last setup started, and how many frames it took to complete
+	uint64 SetupStartFrame = 0;
+	int32 SetupLatencyFrames = INDEX_NONE;
 
 	bool bReturningToParent = false;
 
@@ -82,14 +92,63 @@ protected:
 	FVector2D SelectorDestination;
 	FVector2D Distance;
 
+	// Offset of the selector's canvas panel chain, recomputed only when this widget's size changes
+	FVector2D CachedSelectorLocationOffset = FVector2D::ZeroVector;
+	FVector2D SelectorOffsetLayoutSize = FVector2D(-1.0f, -1.0f);
+
+	// MoveCurve sampled at regular intervals over its time range, so moving the selector doesn't evaluate the curve every frame
+	TArray<float> MoveCurveSamples;
+	TWeakObjectPtr<UCurveFloat> SampledMoveCurve;
+
 	UPROPERTY()
 	UUINavComponent* IgnoreHoverComponent;
 
 	TArray<int> UINavWidgetPath;
 
+	/*
+	* This widget's place in its most outer UINavWidget's hierarchy, rebuilt by the most outer widget whenever a hierarchy is traversed.
+	* Descendants of this widget are the widgets with the same root whose PathEnter is in ]PathEnter, PathExit].
+	*/
+	UPROPERTY()
+	UUINavWidget* PathRoot = nullptr;
+	UPROPERTY()
+	UUINavWidget* PathParent = nullptr;
+	int32 PathDepth = 0;
+	int32 PathEnter = 0;
+	int32 PathExit = 0;
+
+	// Grids of this widget's UINavComponents used for directional navigation when bUseSpatialNavigationIndex is set.
+	// There's one per innermost scroll box (and one for components outside any scroll box), holding rects in that scroll box's content space,
+	// so scrolling doesn't move anything in the grid.
+	TMap<TObjectKey<UScrollBox>, FUINavSpatialIndex> SpatialIndices;
+	// The innermost scroll box of each indexed component, which is the key of its grid
+	TMap<TWeakObjectPtr<UUINavComponent>, TObjectKey<UScrollBox>> SpatialIndexScrollBoxes;
+	// Components waiting to be (re)inserted in the spatial index once they've been laid out
+	TSet<TWeakObjectPtr<UUINavComponent>> DirtySpatialIndexComponents;
+	// This widget's size when the spatial index was last built, which is rebuilt when the layout changes
+	FVector2D SpatialIndexLayoutSize = FVector2D::ZeroVector;
+
+	// The list view item being navigated to, waiting for its entry to be generated
+	TWeakObjectPtr<UListView> PendingListView;
+	TWeakObjectPtr<UObject> PendingListItem;
+	int32 PendingListIndex = INDEX_NONE;
+
+	// The list views whose OnItemScrolledIntoView event this widget is bound to
+	TArray<TWeakObjectPtr<UListView>> BoundListViews;
+
 	TArray<UButton*> SectionButtons;
+
+	// The widget to focus in each of UINavSwitcher's sections, found when the section is first navigated to
 	TArray<UWidget*> SectionWidgets;
 
+	UPROPERTY()
+	TArray<UUINavSectionButtonBinding*> SectionButtonBindings;
+
+	// The UINavSwitcher children that hold the sections created from LazySectionClasses, starting at FirstLazySectionIndex
+	UPROPERTY()
+	TArray<USizeBox*> LazySectionSlots;
+	int32 FirstLazySectionIndex = INDEX_NONE;
+
 	bool bUsingSplitScreen = false;
 
 	/******************************************************************************/
@@ -130,6 +189,9 @@ protected:
 	void HandleSelectorMovement(const float DeltaTime);
 
 	FVector2D GetSelectorLocationOffset(const bool bAbsolute = true);
+
+	void SampleMoveCurve();
+	float GetMoveCurveValue(const float Time) const;
 	FVector2D GetSelectorLocation(const bool bAbsolute = true);
 	void SetSelectorLocation(const FVector2D& NewLocation, const bool bAbsolute = true);
 
@@ -140,26 +202,22 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = UINavWidget)
 	void GoToSection(const int32 SectionIndex);
 
-	UFUNCTION()
-	void OnSectionButtonPressed1();
-	UFUNCTION()
-	void OnSectionButtonPressed2();
-	UFUNCTION()
-	void OnSectionButtonPressed3();
-	UFUNCTION()
-	void OnSectionButtonPressed4();
-	UFUNCTION()
-	void OnSectionButtonPressed5();
-	UFUNCTION()
-	void OnSectionButtonPressed6();
-	UFUNCTION()
-	void OnSectionButtonPressed7();
-	UFUNCTION()
-	void OnSectionButtonPressed8();
-	UFUNCTION()
-	void OnSectionButtonPressed9();
-	UFUNCTION()
-	void OnSectionButtonPressed10();
+	/**
+	*	Creates the section at the given index if it's a lazy section that wasn't created yet
+	*
+	*	@param	SectionIndex  The index of the section in UINavSwitcher
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavWidget)
+	void PreloadSection(const int32 SectionIndex);
+
+	void PreloadAdjacentSections(const int32 SectionIndex);
+
+	/**
+	*	Returns the widget to focus when going to the section at the given index
+	*
+	*	@param	SectionIndex  The index of the section in UINavSwitcher
+	*/
+	UWidget* GetSectionWidget(const int32 SectionIndex);
 
 public:
 
@@ -231,6 +289,36 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = UINavWidget)
 	bool bClearNavigationStateWhenChild = true;
 
+	/*
+	* If set to true, directional navigation between this widget's UINavComponents is resolved through a grid over their layout,
+	* instead of Slate's focus search over the whole widget hierarchy. Useful for menus with a large amount of components.
+	* Components that move without changing this widget's size or scrolling a scroll box should be passed to UpdateSpatialIndex.
+	*/
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = UINavWidget)
+	bool bUseSpatialNavigationIndex = false;
+
+	//The size of each cell of the spatial navigation index. Should be close to the size of this widget's components
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = UINavWidget, meta = (ClampMin = 1, EditCondition = "bUseSpatialNavigationIndex"))
+	float SpatialIndexCellSize = 128.0f;
+
+	/*
+	* If set to true, directional navigation between UINavComponents used as (or inside) UListView and UTileView entries is resolved through the list's item indices.
+	* Items that aren't realized are scrolled into view and their entry is focused once it's generated, so only the visible entries need to exist.
+	*/
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = UINavWidget)
+	bool bUseListViewNavigation = false;
+
+	/*
+	* Classes of the sections to add to UINavSwitcher, after its existing children. Each of these sections is only created
+	* when it's first navigated to, so menus with many pages don't build all of them up front.
+	*/
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = UINavWidget)
+	TArray<TSubclassOf<UUserWidget>> LazySectionClasses;
+
+	//If set to true, the sections next to the active section are also created, so switching to them doesn't have to create them
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = UINavWidget)
+	bool bPreloadAdjacentSections = false;
+
 	//If set to true, this widget will go from the first section to the last and vice-versa when using auto section switching.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = UINavWidget)
 	bool bWrapAutoSectionNavigation = true;
@@ -248,7 +336,8 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = UINavWidget)
 	TArray<TObjectPtr<UInputMappingContext>> InputContextsToAdd;
 
-	/*If set to Left or Right, the gamepad's left or right thumbstick will be used to move the mouse when this widget is active */
+	/*If set to Left or Right, the gamepad's left or right thumbstick will be used to move the mouse when this widget is active.
+	Changing it at runtime takes effect on the next analog input or UINavPC tick. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = UINavWidget)
 	EThumbstickAsMouse UseThumbstickAsMouse = EThumbstickAsMouse::None;
 
@@ -263,6 +352,9 @@ public:
 	bool bCompletedSetup = false;
 	bool bSetupStarted = false;
 
+	//Whether this widget was created through the UINavPC's widget pool and should be returned to it when removed
+	bool bAcquiredFromPool = false;
+
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "UINavigation Selector")
 	UCurveFloat* MoveCurve = nullptr;
 
@@ -279,12 +371,28 @@ public:
 
 	
 	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
 
 	virtual FReply NativeOnKeyDown(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
 	virtual FReply NativeOnKeyUp(const FGeometry& InGeometry, const FKeyEvent& InKeyEvent) override;
 
 	virtual void NativeTick(const FGeometry & MyGeometry, float DeltaTime) override;
 
+	/**
+	*	Enables ticking until this widget is idle again (no selector movement, pending mouse move or hovered component)
+	*/
+	void RequestNativeTick();
+
+	// Whether ticking can be disabled, which isn't the case if the widget is animating or ticks in Blueprint
+	bool CanStopTicking() const;
+
+	/**
+	*	Handles the pending setup and selector update once this widget has been laid out
+	*/
+	void RequestLayoutReadyCallback();
+	void OnLayoutReady(const float DeltaTime);
+	void StopWaitingForLayout();
+
 	virtual void RemoveFromParent() override;
 
 	virtual FReply NativeOnFocusReceived(const FGeometry& InGeometry, const FFocusEvent& InFocusEvent) override;
@@ -325,6 +433,13 @@ public:
 	*/
 	void TraverseHierarchy();
 
+	/**
+	*	Rebuilds the path table of this widget's hierarchy. Should be called on the most outer UINavWidget
+	*/
+	void RebuildWidgetPathTable();
+
+	void BuildWidgetPathTable(UUINavWidget* Root, UUINavWidget* Parent, const int IndexInParent, int32& Counter);
+
 	void SetupSections();
 
 	/**
@@ -409,6 +524,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = UINavWidget)
 	void UpdateSelectorLocation(UUINavComponent* Component);
 
+	/**
+	*	Discards the cached selector offset and movement curve samples, in case the selector's canvas panels
+	*	or the MoveCurve changed without this widget's size changing
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavWidget)
+	void InvalidateSelectorCache();
+
 	/**
 	*	Plays the animations in the UINavAnimations array
 	*
@@ -654,11 +776,21 @@ public:
 
 	UUINavWidget* GetChildUINavWidget(const int ChildIndex) const;
 
-	FORCEINLINE TArray<int> GetUINavWidgetPath() const { return UINavWidgetPath; }
+	FORCEINLINE const TArray<int>& GetUINavWidgetPath() const { return UINavWidgetPath; }
 
-	EThumbstickAsMouse GetUseThumbstickAsMouse() const;
+	FORCEINLINE UUINavWidget* GetPathParent() const { return PathParent; }
+
+	FORCEINLINE int32 GetPathDepth() const { return PathDepth; }
 
-	void AddParentToPath(const int IndexInParent);
+	/**
+	*	Returns whether this widget is nested (at any depth) inside the given widget, using the precomputed path table
+	*
+	*	@param	Ancestor  The widget that may contain this one
+	*	@param	bIncludeSelf  Whether this widget counts as being inside itself
+	*/
+	bool IsDescendantOf(const UUINavWidget* const Ancestor, const bool bIncludeSelf = true) const;
+
+	EThumbstickAsMouse GetUseThumbstickAsMouse() const;
 
 	UUINavComponent* GetFirstComponent() const { return FirstComponent; }
 
@@ -666,9 +798,86 @@ public:
 
 	void RemovedComponent(UUINavComponent* Component);
 
+	/**
+	*	Called when one of the section buttons is clicked
+	*
+	*	@param	SectionIndex  The index of the clicked button's section
+	*/
+	void OnSectionButtonClicked(const int32 SectionIndex);
+
+	/**
+	*	Schedules the given component to be (re)inserted in the spatial navigation index, after it appeared or moved
+	*
+	*	@param	Component  The component that changed
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavWidget)
+	void UpdateSpatialIndex(UUINavComponent* Component);
+
+	/**
+	*	Reinserts all the components in the spatial navigation index
+	*/
+	UFUNCTION(BlueprintCallable, Category = UINavWidget)
+	void RebuildSpatialIndex();
+
+	/**
+	*	Returns the closest navigable component in the given direction using the spatial navigation index,
+	*	or nullptr if it isn't enabled or there's no component in that direction
+	*
+	*	@param	FromComponent  The component to start from
+	*	@param	Direction  The direction to navigate in
+	*/
+	UUINavComponent* FindComponentInDirection(UUINavComponent* FromComponent, const EUINavigation Direction);
+
+	bool GetSpatialIndexRect(const UUINavComponent* Component, FBox2D& OutRect) const;
+
+	/**
+	*	Returns how far the content of the given scroll box and of the scroll boxes containing it within this widget is scrolled,
+	*	which converts rects in that scroll box's content space to this widget's local space
+	*/
+	FVector2D GetSpatialIndexScrollOffset(const UScrollBox* ScrollBox) const;
+
+	// Inserts or moves the given component in the grid of its innermost scroll box, given its rect in this widget's local space
+	void AddToSpatialIndex(UUINavComponent* Component, const FBox2D& Rect);
+
+	void RemoveFromSpatialIndex(UUINavComponent* Component);
+
+	void FlushSpatialIndex();
+
+	/**
+	*	Navigates from the given list view entry component to the list item in the given direction, if bUseListViewNavigation is set
+	*
+	*	@param	FromComponent  The component to start from
+	*	@param	Direction  The direction to navigate in
+	*	@return  Whether the navigation was handled by the list
+	*/
+	bool TryNavigateListView(UUINavComponent* FromComponent, const EUINavigation Direction);
+
+	/**
+	*	Scrolls the item at the given index into view and focuses its entry's UINavComponent, as soon as it's generated
+	*
+	*	@param	ListView  The list view containing the item
+	*	@param	Index  The item's index
+	*/
+	void NavigateToListIndex(UListView* ListView, const int32 Index);
+
+	int32 GetListIndexInDirection(const UListView* ListView, const int32 Index, const EUINavigation Direction) const;
+
+	UUserWidget* GetListEntryWidget(UUINavComponent* Component) const;
+
+	static UUINavComponent* FindComponentInListEntry(UUserWidget* EntryWidget);
+
+	void OnListItemScrolledIntoView(UObject* Item, UUserWidget& EntryWidget);
+
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavWidget)
 	bool IsSelectorValid();
 
+	/**
+	*	Returns how many frames the last setup of this widget took, from its start until the widget was ready and focused,
+	*	or -1 if it hasn't completed yet
+	*/
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = UINavWidget)
+	int32 GetSetupLatencyFrames() const { return SetupLatencyFrames; }
+
 	FORCEINLINE uint8 GetSelectCount() const { return SelectCount; }
 
 	/**
@@ -713,6 +922,25 @@ public:
 
 	void RemoveSelfAndAllParents();
 
+	/**
+	*	Returns this widget to the UINavPC's widget pool, if it was acquired from it
+	*/
+	void ReleaseToPool();
+
+	/**
+	*	Resets this widget's navigation state so that it can be reused by GoToWidget
+	*/
+	virtual void ResetForPool();
+
+	/**
+	*	Called when this widget is returned to the UINavPC's widget pool.
+	*	Use it to reset any state that shouldn't carry over when this widget is reused.
+	*/
+	UFUNCTION(BlueprintNativeEvent, Category = UINavWidget)
+	void OnReturnedToPool();
+
+	virtual void OnReturnedToPool_Implementation() {}
+
 	int GetWidgetHierarchyDepth(UWidget* Widget) const;
 
 	FORCEINLINE bool HasNavigation() const { return bHasNavigation; }
@@ -11,13 +11,33 @@ class UINAVIGATION_API FUINavigationConfig : public FNavigationConfig
 public:
 	FUINavigationConfig(const UUINavPCComponent* const UINavPC, const bool bAllowDirectionalInput = true, const bool bAllowSectionInput = true, const bool bAllowAccept = true, const bool bAllowBack = true, const bool bUseAnalogDirectionalInput = true, const bool bUsingThumbstickAsMouse = false);
 
+	/**
+	*	Updates this config's rules in place, only changing the ones that differ from the current ones
+	*
+	*	@return Whether any rule was changed
+	*/
+	bool Refresh(const UUINavPCComponent* const UINavPC, const bool bAllowDirectionalInput, const bool bAllowSectionInput, const bool bAllowAccept, const bool bAllowBack, const bool bUseAnalogDirectionalInput, const bool bUsingThumbstickAsMouse);
+
 	virtual EUINavigationAction GetNavigationActionForKey(const FKey& InKey) const override;
 
 	virtual EUINavigation GetNavigationDirectionFromAnalog(const FAnalogInputEvent& InAnalogEvent) override;
 
 	EUINavigation GetNavigationDirectionFromAnalogKey(const FKeyEvent& InKeyEvent) const;
 
-	TArray<FKey> GetKeysForDirection(const EUINavigation Direction) const;
+	const TArray<FKey>& GetKeysForDirection(const EUINavigation Direction) const;
+
+	const TArray<FKey>& GetKeysForAction(const EUINavigationAction Action) const;
+
+	/**
+	*	Moves the navigation rules of a rebound key to its new key, without rebuilding the whole config
+	*
+	*	@param	UINavPC  The UINav PC component whose input context the config was gathered from
+	*	@param	PlayerMappableKeySettingsName  The name of the rebound player mappable key settings
+	*	@param	OldKey  The key that was replaced
+	*	@param	NewKey  The key that replaces it
+	*	@return Whether the rebind was applied. If not, the config should be rebuilt.
+	*/
+	bool RebindKey(const UUINavPCComponent* const UINavPC, const FName PlayerMappableKeySettingsName, const FKey& OldKey, const FKey& NewKey);
 
 	virtual bool IsAnalogHorizontalKey(const FKey& InKey) const override { return InKey == EKeys::Gamepad_LeftX || InKey == EKeys::Gamepad_RightX; }
 	virtual bool IsAnalogVerticalKey(const FKey& InKey) const override { return InKey == EKeys::Gamepad_LeftY || InKey == EKeys::Gamepad_RightY; }
@@ -25,4 +45,22 @@ public:
 	const TArray<FKey>& GetGamepadSelectKeys() const { return GamepadSelectKeys; }
 
 	TArray<FKey> GamepadSelectKeys;
+
+protected:
+
+	static void GatherRules(const UUINavPCComponent* const UINavPC, const bool bAllowDirectionalInput, const bool bAllowSectionInput, const bool bAllowAccept, const bool bAllowBack, const bool bUsingThumbstickAsMouse,
+		TMap<FKey, EUINavigation>& OutDirectionRules, TMap<FKey, EUINavigationAction>& OutActionRules, TArray<FKey>& OutGamepadSelectKeys);
+
+	void AddDirectionRule(const FKey& Key, const EUINavigation Direction);
+	void AddActionRule(const FKey& Key, const EUINavigationAction Action);
+	void RemoveDirectionRule(const FKey& Key);
+	void RemoveActionRule(const FKey& Key);
+	void RemoveKeyRules(const FKey& Key);
+
+	static bool IsExcludedMappableKey(const FKey& Key);
+
+	TMap<EUINavigation, TArray<FKey>> DirectionKeys;
+	TMap<EUINavigationAction, TArray<FKey>> ActionKeys;
+
+	bool bThumbstickUsedAsMouse = false;
 };
\ No newline at end of file
@@ -37,6 +37,7 @@ public UINavigation(ReadOnlyTargetRules Target) : base(Target)
                 "HeadMountedDisplay",
 				"AssetRegistry",
 				"GameplayTags",
+				"Projects",
 			}
 			);
 		